@@ -2,6 +2,8 @@
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/utilities/PerfTimers.H"
+#include "amr-wind/core/LoadBalancer.H"
 #include "amr-wind/overset/OversetManager.H"
 #include "amr-wind/core/ExtSolver.H"
 
@@ -17,6 +19,8 @@ CFDSim::CFDSim(amrex::AmrCore& mesh)
     , m_post_mgr(new PostProcessManager(*this))
     , m_ext_solver_mgr(new ExtSolverMgr)
     , m_helics(new helics_storage(*this))
+    , m_perf_timers(new PerfTimers)
+    , m_load_balancer(new LoadBalancer(*this))
 {}
 
 CFDSim::~CFDSim() = default;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 
 #include "amr-wind/core/FieldRepo.H"
@@ -16,6 +17,7 @@ void FieldRepo::make_new_level_from_scratch(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_new_level_from_scratch");
+    invalidate_scratch_pool();
     m_leveldata[lev] = std::make_unique<LevelDataHolder>();
 
     allocate_field_data(
@@ -33,6 +35,7 @@ void FieldRepo::make_new_level_from_coarse(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_level_from_coarse");
+    invalidate_scratch_pool();
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
@@ -57,6 +60,7 @@ void FieldRepo::remake_level(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::remake_level");
+    invalidate_scratch_pool();
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
@@ -77,6 +81,7 @@ void FieldRepo::remake_level(
 void FieldRepo::clear_level(int lev)
 {
     BL_PROFILE("amr-wind::FieldRepo::clear_level");
+    invalidate_scratch_pool();
     m_leveldata[lev].reset();
 }
 
@@ -306,23 +311,7 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
     const FieldLoc floc) const
 {
     BL_PROFILE("amr-wind::FieldRepo::create_scratch_field");
-    if (!m_is_initialized) {
-        amrex::Abort(
-            "Scratch field creation is not permitted before mesh is "
-            "initialized");
-    }
-    std::unique_ptr<ScratchField> field(
-        new ScratchField(*this, name, ncomp, nghost, floc));
-
-    for (int lev = 0; lev <= m_mesh.finestLevel(); ++lev) {
-        const auto ba =
-            amrex::convert(m_mesh.boxArray(lev), field_impl::index_type(floc));
-
-        field->m_data.emplace_back(
-            ba, m_mesh.DistributionMap(lev), ncomp, nghost, amrex::MFInfo(),
-            *(m_leveldata[lev]->m_factory));
-    }
-    return field;
+    return make_scratch_field(name, ncomp, nghost, floc, false);
 }
 
 std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
@@ -338,33 +327,144 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field_on_host(
     const FieldLoc floc) const
 {
     BL_PROFILE("amr-wind::FieldRepo::create_scratch_field_on_host");
+    return make_scratch_field(name, ncomp, nghost, floc, true);
+}
+
+std::unique_ptr<ScratchField> FieldRepo::create_scratch_field_on_host(
+    const int ncomp, const int nghost, const FieldLoc floc) const
+{
+    return create_scratch_field_on_host(
+        "scratch_field_host", ncomp, nghost, floc);
+}
+
+namespace {
+
+amrex::Long scratch_data_bytes(const amrex::Vector<amrex::MultiFab>& data)
+{
+    amrex::Long nbytes = 0;
+    for (const auto& mf : data) {
+        for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            nbytes += mf[mfi].nBytes();
+        }
+    }
+    return nbytes;
+}
+
+std::array<int, 4 + AMREX_SPACEDIM> scratch_key(
+    const int ncomp,
+    const amrex::IntVect& ngrow,
+    const FieldLoc floc,
+    const int nlevels,
+    const bool on_host)
+{
+    std::array<int, 4 + AMREX_SPACEDIM> key{
+        {ncomp, static_cast<int>(floc), nlevels, static_cast<int>(on_host)}};
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        key[4 + i] = ngrow[i];
+    }
+    return key;
+}
+
+} // namespace
+
+std::unique_ptr<ScratchField> FieldRepo::make_scratch_field(
+    const std::string& name,
+    const int ncomp,
+    const int nghost,
+    const FieldLoc floc,
+    const bool on_host) const
+{
     if (!m_is_initialized) {
         amrex::Abort(
             "Scratch field creation is not permitted before mesh is "
             "initialized");
     }
-
     std::unique_ptr<ScratchField> field(
         new ScratchField(*this, name, ncomp, nghost, floc));
+    field->m_on_host = on_host;
+
+    if (m_use_scratch_pool) {
+        field->m_pool_generation = m_scratch_generation;
+        auto found = m_scratch_pool.find(scratch_key(
+            ncomp, field->m_ngrow, floc, num_active_levels(), on_host));
+        if ((found != m_scratch_pool.end()) && !found->second.empty()) {
+            field->m_data = std::move(found->second.back());
+            found->second.pop_back();
+            field->m_pool_bytes = scratch_data_bytes(field->m_data);
+            m_scratch_stats.pooled_bytes -= field->m_pool_bytes;
+            ++m_scratch_stats.num_hits;
+            return field;
+        }
+    }
 
+    const auto info = on_host
+                          ? amrex::MFInfo().SetArena(amrex::The_Pinned_Arena())
+                          : amrex::MFInfo();
     for (int lev = 0; lev <= m_mesh.finestLevel(); ++lev) {
         const auto ba =
             amrex::convert(m_mesh.boxArray(lev), field_impl::index_type(floc));
 
         field->m_data.emplace_back(
-            ba, m_mesh.DistributionMap(lev), ncomp, nghost,
-            amrex::MFInfo().SetArena(amrex::The_Pinned_Arena()),
+            ba, m_mesh.DistributionMap(lev), ncomp, nghost, info,
             *(m_leveldata[lev]->m_factory));
     }
+
+    if (m_use_scratch_pool) {
+        field->m_pool_bytes = scratch_data_bytes(field->m_data);
+        ++m_scratch_stats.num_misses;
+        m_scratch_stats.current_bytes += field->m_pool_bytes;
+        m_scratch_stats.peak_bytes = std::max(
+            m_scratch_stats.peak_bytes, m_scratch_stats.current_bytes);
+    }
     return field;
 }
 
-std::unique_ptr<ScratchField> FieldRepo::create_scratch_field_on_host(
-    const int ncomp, const int nghost, const FieldLoc floc) const
+void FieldRepo::release_scratch_field(ScratchField& field) const
 {
-    return create_scratch_field_on_host(
-        "scratch_field_host", ncomp, nghost, floc);
+    auto& data = field.m_data;
+    bool reusable = m_use_scratch_pool &&
+                    (field.m_pool_generation == m_scratch_generation) &&
+                    (static_cast<int>(data.size()) == num_active_levels());
+
+    // Ensure the data was not moved or redefined by the user
+    for (int lev = 0; reusable && (lev < static_cast<int>(data.size()));
+         ++lev) {
+        const auto& mf = data[lev];
+        reusable =
+            mf.ok() && (mf.nComp() == field.m_ncomp) &&
+            (mf.nGrowVect() == field.m_ngrow) &&
+            (mf.boxArray() ==
+             amrex::convert(
+                 m_mesh.boxArray(lev),
+                 field_impl::index_type(field.m_floc))) &&
+            (mf.DistributionMap() == m_mesh.DistributionMap(lev));
+    }
+
+    if (!reusable) {
+        m_scratch_stats.current_bytes -= field.m_pool_bytes;
+        return;
+    }
+
+    m_scratch_stats.pooled_bytes += field.m_pool_bytes;
+    const auto key = scratch_key(
+        field.m_ncomp, field.m_ngrow, field.m_floc,
+        static_cast<int>(data.size()), field.m_on_host);
+    m_scratch_pool[key].push_back(std::move(data));
+}
+
+void FieldRepo::clear_scratch_pool() const
+{
+    m_scratch_pool.clear();
+    m_scratch_stats.current_bytes -= m_scratch_stats.pooled_bytes;
+    m_scratch_stats.pooled_bytes = 0;
 }
+
+void FieldRepo::invalidate_scratch_pool() const
+{
+    clear_scratch_pool();
+    ++m_scratch_generation;
+}
+
 std::unique_ptr<IntScratchField> FieldRepo::create_int_scratch_field_on_host(
     const std::string& name,
     const int ncomp,
@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "amr-wind/core/LoadBalancer.H"
+#include "amr-wind/CFDSim.H"
+
+#include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Utility.H"
+
+namespace amr_wind {
+
+LoadBalancer::BoxTimer::BoxTimer(amrex::Real* box_times, const int box)
+    : m_box_times(box_times), m_box(box)
+{
+    if (m_box_times != nullptr) {
+        m_start = amrex::second();
+    }
+}
+
+LoadBalancer::BoxTimer::~BoxTimer()
+{
+    if (m_box_times == nullptr) {
+        return;
+    }
+    amrex::Gpu::streamSynchronize();
+    const amrex::Real elapsed = amrex::second() - m_start;
+#ifdef AMREX_USE_OMP
+#pragma omp atomic
+#endif
+    m_box_times[m_box] += elapsed;
+}
+
+LoadBalancer::LoadBalancer(CFDSim& sim) : m_sim(sim) {}
+
+void LoadBalancer::initialize()
+{
+    amrex::ParmParse pp("load_balance");
+
+    std::string method{"none"};
+    pp.query("method", method);
+    if (method == "none") {
+        m_method = Method::None;
+    } else if (method == "knapsack") {
+        m_method = Method::KnapSack;
+    } else if (method == "sfc") {
+        m_method = Method::SFC;
+    } else {
+        amrex::Abort(
+            "LoadBalancer: invalid load_balance.method = " + method +
+            ". Valid options are: none, knapsack, sfc");
+    }
+
+    std::string cost_type{"work_estimate"};
+    pp.query("cost", cost_type);
+    if (cost_type == "cells") {
+        m_cost_type = CostType::Cells;
+    } else if (cost_type == "work_estimate") {
+        m_cost_type = CostType::WorkEstimate;
+    } else if (cost_type == "timers") {
+        m_cost_type = CostType::Timers;
+    } else {
+        amrex::Abort(
+            "LoadBalancer: invalid load_balance.cost = " + cost_type +
+            ". Valid options are: cells, work_estimate, timers");
+    }
+
+    pp.query("on_regrid", m_on_regrid);
+    pp.query("check_interval", m_check_interval);
+    pp.query("imbalance_threshold", m_threshold);
+    pp.query("vof_interface_weight", m_vof_weight);
+    pp.query("overset_fringe_weight", m_overset_weight);
+    pp.query("actuator_weight", m_actuator_weight);
+
+    if (enabled()) {
+        amrex::Print() << "Load balancing enabled: method = " << method
+                       << ", cost = " << cost_type << std::endl;
+    }
+}
+
+amrex::Vector<amrex::Real> LoadBalancer::work_estimate(const int lev) const
+{
+    BL_PROFILE("amr-wind::LoadBalancer::work_estimate");
+    const auto& mesh = m_sim.mesh();
+    const auto& repo = m_sim.repo();
+    const auto& ba = mesh.boxArray(lev);
+    const auto& dm = mesh.DistributionMap(lev);
+
+    const bool use_weights = (m_cost_type != CostType::Cells);
+    const amrex::MultiFab* vof = (use_weights && repo.field_exists("vof"))
+                                     ? &repo.get_field("vof")(lev)
+                                     : nullptr;
+    const amrex::iMultiFab* iblank =
+        (use_weights && repo.int_field_exists("iblank_cell"))
+            ? &repo.get_int_field("iblank_cell")(lev)
+            : nullptr;
+    const amrex::MultiFab* act_src =
+        (use_weights && repo.field_exists("actuator_src_term"))
+            ? &repo.get_field("actuator_src_term")(lev)
+            : nullptr;
+
+    const amrex::Real vof_extra = m_vof_weight - 1.0;
+    const amrex::Real ovst_extra = m_overset_weight - 1.0;
+    const amrex::Real act_extra = m_actuator_weight - 1.0;
+    constexpr amrex::Real vof_tol = 1.0e-12;
+
+    amrex::Vector<amrex::Real> costs(ba.size(), 0.0);
+    for (amrex::MFIter mfi(ba, dm); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        amrex::Real extra = 0.0;
+
+        if ((vof != nullptr) || (iblank != nullptr) || (act_src != nullptr)) {
+            amrex::Gpu::DeviceScalar<amrex::Real> dextra(0.0);
+            amrex::Real* extra_ptr = dextra.dataPtr();
+
+            const bool has_vof = (vof != nullptr);
+            const bool has_iblank = (iblank != nullptr);
+            const bool has_act = (act_src != nullptr);
+            const auto vof_arr = has_vof ? vof->const_array(mfi)
+                                         : amrex::Array4<amrex::Real const>();
+            const auto ib_arr = has_iblank ? iblank->const_array(mfi)
+                                           : amrex::Array4<int const>();
+            const auto act_arr = has_act ? act_src->const_array(mfi)
+                                         : amrex::Array4<amrex::Real const>();
+
+            amrex::ParallelFor(
+                amrex::Gpu::KernelInfo().setReduction(true), bx,
+                [=] AMREX_GPU_DEVICE(
+                    int i, int j, int k,
+                    amrex::Gpu::Handler const& handler) noexcept {
+                    amrex::Real wt = 0.0;
+                    if (has_vof && (vof_arr(i, j, k) > vof_tol) &&
+                        (vof_arr(i, j, k) < 1.0 - vof_tol)) {
+                        wt += vof_extra;
+                    }
+                    if (has_iblank && (ib_arr(i, j, k) == -1)) {
+                        wt += ovst_extra;
+                    }
+                    if (has_act &&
+                        ((act_arr(i, j, k, 0) != 0.0) ||
+                         (act_arr(i, j, k, 1) != 0.0) ||
+                         (act_arr(i, j, k, 2) != 0.0))) {
+                        wt += act_extra;
+                    }
+                    amrex::Gpu::deviceReduceSum(extra_ptr, wt, handler);
+                });
+            extra = dextra.dataValue();
+        }
+
+        costs[mfi.index()] = static_cast<amrex::Real>(bx.numPts()) + extra;
+    }
+
+    amrex::ParallelDescriptor::ReduceRealSum(
+        costs.data(), static_cast<int>(costs.size()));
+    return costs;
+}
+
+amrex::Real* LoadBalancer::box_times(const int lev)
+{
+    if (static_cast<int>(m_box_times.size()) <= lev) {
+        m_box_times.resize(lev + 1);
+    }
+    const auto nboxes = m_sim.mesh().boxArray(lev).size();
+    if (static_cast<amrex::Long>(m_box_times[lev].size()) != nboxes) {
+        m_box_times[lev].assign(nboxes, 0.0);
+    }
+    return m_box_times[lev].data();
+}
+
+amrex::Vector<amrex::Real> LoadBalancer::box_costs(const int lev) const
+{
+    BL_PROFILE("amr-wind::LoadBalancer::box_costs");
+    const auto nboxes = static_cast<int>(m_sim.mesh().boxArray(lev).size());
+    const bool has_times =
+        (m_cost_type == CostType::Timers) &&
+        (lev < static_cast<int>(m_box_times.size())) &&
+        (static_cast<int>(m_box_times[lev].size()) == nboxes);
+
+    // Each box is owned by a single rank, so the sum gathers the times of all
+    // boxes on every rank
+    amrex::Vector<amrex::Real> costs(nboxes, 0.0);
+    if (has_times) {
+        costs = m_box_times[lev];
+    }
+    if (m_cost_type == CostType::Timers) {
+        amrex::ParallelDescriptor::ReduceRealSum(costs.data(), nboxes);
+    }
+
+    // Fall back to the work estimate until box times have been measured
+    const bool measured =
+        std::any_of(costs.begin(), costs.end(), [](const amrex::Real c) {
+            return c > 0.0;
+        });
+    if (!measured) {
+        return work_estimate(lev);
+    }
+    return costs;
+}
+
+amrex::Real LoadBalancer::propose(
+    const amrex::Vector<amrex::Real>& costs,
+    const int lev,
+    amrex::DistributionMapping& new_dm,
+    const int nprocs) const
+{
+    BL_PROFILE("amr-wind::LoadBalancer::propose");
+    AMREX_ALWAYS_ASSERT(enabled());
+    const int nranks =
+        (nprocs > 0) ? nprocs : amrex::ParallelDescriptor::NProcs();
+
+    // The AMReX algorithms work with integer weights
+    const amrex::Real max_cost =
+        costs.empty() ? 0.0 : *std::max_element(costs.begin(), costs.end());
+    const amrex::Real scale = (max_cost > 0.0) ? 1.0e9 / max_cost : 1.0;
+    std::vector<amrex::Long> wgts(costs.size());
+    for (int i = 0; i < static_cast<int>(costs.size()); ++i) {
+        wgts[i] = static_cast<amrex::Long>(costs[i] * scale) + 1;
+    }
+
+    if (m_method == Method::KnapSack) {
+        new_dm.KnapSackProcessorMap(wgts, nranks);
+    } else {
+        new_dm.SFCProcessorMap(m_sim.mesh().boxArray(lev), wgts, nranks);
+    }
+    return imbalance(costs, new_dm, nranks);
+}
+
+amrex::Real LoadBalancer::imbalance(
+    const amrex::Vector<amrex::Real>& costs,
+    const amrex::DistributionMapping& dm,
+    const int nprocs)
+{
+    const int nranks =
+        (nprocs > 0) ? nprocs : amrex::ParallelDescriptor::NProcs();
+    amrex::Vector<amrex::Real> rank_cost(nranks, 0.0);
+    for (int i = 0; i < static_cast<int>(costs.size()); ++i) {
+        rank_cost[dm[i]] += costs[i];
+    }
+
+    const amrex::Real total =
+        std::accumulate(rank_cost.begin(), rank_cost.end(), 0.0);
+    const amrex::Real max_cost =
+        *std::max_element(rank_cost.begin(), rank_cost.end());
+    return (total > 0.0) ? max_cost * nranks / total : 1.0;
+}
+
+} // namespace amr_wind
@@ -44,6 +44,7 @@ void MLMGOptions::parse_options(const std::string& prefix)
     pp.query("num_bottom_smooth", num_bottom_smooth);
 
     pp.query("do_fixed_iters", do_fixed_iters);
+    pp.query("reuse_solver", reuse_solver);
 
     pp.query("bottom_maxiter", bottom_max_iter);
     pp.query("bottom_rtol", bottom_rel_tol);
@@ -10,6 +10,13 @@
 
 namespace amr_wind {
 
+ScratchField::~ScratchField()
+{
+    if (m_pool_generation >= 0) {
+        m_repo.release_scratch_field(*this);
+    }
+}
+
 namespace {
 struct SFBCNoOp
 {
@@ -105,6 +105,25 @@ void DiffSolverIface<LinOp>::setup_solver(amrex::MLMG& mlmg)
     m_options(mlmg);
 }
 
+template <typename LinOp>
+amrex::MLMG& DiffSolverIface<LinOp>::solver_mlmg()
+{
+    if (!m_solver_mlmg || !m_options.reuse_variable_coeff_solver()) {
+        m_solver_mlmg = std::make_unique<amrex::MLMG>(*m_solver);
+        this->setup_solver(*m_solver_mlmg);
+    }
+    return *m_solver_mlmg;
+}
+
+template <typename LinOp>
+amrex::MLMG& DiffSolverIface<LinOp>::applier_mlmg()
+{
+    if (!m_applier_mlmg || !m_options.reuse_solver) {
+        m_applier_mlmg = std::make_unique<amrex::MLMG>(*m_applier);
+    }
+    return *m_applier_mlmg;
+}
+
 template <typename LinOp>
 void DiffSolverIface<LinOp>::linsys_solve_impl()
 {
@@ -143,9 +162,7 @@ void DiffSolverIface<LinOp>::linsys_solve_impl()
         }
     }
 
-    amrex::MLMG mlmg(*this->m_solver);
-    this->setup_solver(mlmg);
-
+    auto& mlmg = this->solver_mlmg();
     mlmg.solve(
         field.vec_ptrs(), rhs_ptr->vec_const_ptrs(), this->m_options.rel_tol,
         this->m_options.abs_tol);
@@ -8,6 +8,66 @@ using namespace amrex;
 
 namespace amr_wind {
 
+void multiphase::split_band_states(
+    const int nlevels,
+    Field const& dof_field,
+    const int nband,
+    amrex::Vector<amrex::Vector<BandState>>& band)
+{
+    BL_PROFILE("amr-wind::multiphase::split_band_states");
+    AMREX_ALWAYS_ASSERT(nband <= dof_field.num_grow()[0]);
+
+    // Same thresholds as multiphase::eulerian_implicit
+    constexpr amrex::Real tiny = 1e-12;
+    // Flags per box: contains full cells, empty cells, interface cells
+    constexpr int nflags = 3;
+
+    band.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& vof = dof_field(lev);
+        const int nbox = vof.local_size();
+        band[lev].assign(nbox, BandState::active);
+        if (nbox == 0) {
+            continue;
+        }
+
+        amrex::Gpu::DeviceVector<int> flags_d(nflags * nbox, 0);
+        auto* flags = flags_d.data();
+        const auto& vof_arrs = vof.const_arrays();
+        amrex::ParallelFor(
+            vof, amrex::IntVect(nband),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                const amrex::Real vf = vof_arrs[nbx](i, j, k);
+                if (std::abs(vf - 1.0) <= tiny) {
+                    flags[nflags * nbx] = 1;
+                } else if (vf <= tiny) {
+                    flags[nflags * nbx + 1] = 1;
+                } else {
+                    flags[nflags * nbx + 2] = 1;
+                }
+            });
+        amrex::Vector<int> flags_h(nflags * nbox);
+        amrex::Gpu::copy(
+            amrex::Gpu::deviceToHost, flags_d.begin(), flags_d.end(),
+            flags_h.begin());
+
+        const auto& ba = vof.boxArray();
+        for (amrex::MFIter mfi(vof); mfi.isValid(); ++mfi) {
+            const int n = mfi.LocalIndex();
+            const bool has_full = flags_h[nflags * n] != 0;
+            const bool has_empty = flags_h[nflags * n + 1] != 0;
+            const bool has_interface = flags_h[nflags * n + 2] != 0;
+            const bool covered =
+                (lev == 0) || ba.contains(amrex::grow(mfi.validbox(), nband));
+            if (has_interface || (has_full && has_empty) || !covered) {
+                band[lev][n] = BandState::active;
+            } else {
+                band[lev][n] = has_full ? BandState::full : BandState::empty;
+            }
+        }
+    }
+}
+
 void multiphase::split_advection_step(
     int isweep,
     int iorder,
@@ -22,10 +82,18 @@ void multiphase::split_advection_step(
     amrex::GpuArray<BC, AMREX_SPACEDIM * 2> BCs,
     amrex::Vector<amrex::Geometry> geom,
     amrex::Real dt,
-    bool rm_debris)
+    bool rm_debris,
+    ScratchField& vof_lr,
+    amrex::Vector<amrex::Vector<BandState>> const& band)
 {
     BL_PROFILE("amr-wind::multiphase::split_advection_step");
 
+    // An empty band list indicates that all boxes are active
+    auto box_state = [&band](const int lev, const amrex::MFIter& mfi) {
+        return band.empty() ? BandState::active
+                            : band[lev][mfi.LocalIndex()];
+    };
+
     for (int lev = 0; lev < nlevels; ++lev) {
         amrex::MFItInfo mfi_info;
         if (amrex::Gpu::notInLaunchRegion()) {
@@ -38,8 +106,18 @@ void multiphase::split_advection_step(
         for (amrex::MFIter mfi(dof_field(lev), mfi_info); mfi.isValid();
              ++mfi) {
             const auto& bx = mfi.tilebox();
-            amrex::FArrayBox tmpfab(amrex::grow(bx, 1), 2);
-            tmpfab.setVal<amrex::RunOn::Device>(0.0);
+            const auto state = box_state(lev, mfi);
+
+            if (state != BandState::active) {
+                multiphase::split_uniform_fluxes(
+                    lev, bx, isweep + iorder, state == BandState::full,
+                    u_mac(lev).const_array(mfi), v_mac(lev).const_array(mfi),
+                    w_mac(lev).const_array(mfi), (*advas[lev][0]).array(mfi),
+                    (*advas[lev][1]).array(mfi), (*advas[lev][2]).array(mfi),
+                    (*fluxes[lev][0]).array(mfi), (*fluxes[lev][1]).array(mfi),
+                    (*fluxes[lev][2]).array(mfi), BCs, geom, dt);
+                continue;
+            }
 
             // Compression term coefficient
             if (iorder == 0) {
@@ -54,9 +132,8 @@ void multiphase::split_advection_step(
                 w_mac(lev).const_array(mfi), (*advas[lev][0]).array(mfi),
                 (*advas[lev][1]).array(mfi), (*advas[lev][2]).array(mfi),
                 (*fluxes[lev][0]).array(mfi), (*fluxes[lev][1]).array(mfi),
-                (*fluxes[lev][2]).array(mfi), BCs, tmpfab.dataPtr(), geom, dt);
-
-            amrex::Gpu::streamSynchronize();
+                (*fluxes[lev][2]).array(mfi), BCs, vof_lr(lev).array(mfi, 0),
+                vof_lr(lev).array(mfi, 1), geom, dt);
         }
     }
 
@@ -82,14 +159,17 @@ void multiphase::split_advection_step(
         for (amrex::MFIter mfi(dof_field(lev), mfi_info); mfi.isValid();
              ++mfi) {
             const auto& bx = mfi.tilebox();
-            // Sum fluxes from this stage of advection
-            multiphase::split_compute_sum(
-                lev, bx, isweep + iorder, dof_field(lev).array(mfi),
-                fluxC(lev).const_array(mfi), u_mac(lev).const_array(mfi),
-                v_mac(lev).const_array(mfi), w_mac(lev).const_array(mfi),
-                (*fluxes[lev][0]).const_array(mfi),
-                (*fluxes[lev][1]).const_array(mfi),
-                (*fluxes[lev][2]).const_array(mfi), geom, dt);
+            // Fluxes balance in boxes away from the interface
+            if (box_state(lev, mfi) == BandState::active) {
+                // Sum fluxes from this stage of advection
+                multiphase::split_compute_sum(
+                    lev, bx, isweep + iorder, dof_field(lev).array(mfi),
+                    fluxC(lev).const_array(mfi), u_mac(lev).const_array(mfi),
+                    v_mac(lev).const_array(mfi), w_mac(lev).const_array(mfi),
+                    (*fluxes[lev][0]).const_array(mfi),
+                    (*fluxes[lev][1]).const_array(mfi),
+                    (*fluxes[lev][2]).const_array(mfi), geom, dt);
+            }
 
             // Remove debris if desired after last step
             if (rm_debris && iorder == 2) {
@@ -117,12 +197,12 @@ void multiphase::split_compute_fluxes(
     amrex::Array4<amrex::Real> const& fy,
     amrex::Array4<amrex::Real> const& fz,
     amrex::GpuArray<BC, AMREX_SPACEDIM * 2> BCs,
-    amrex::Real* p,
+    amrex::Array4<amrex::Real> const& vofL,
+    amrex::Array4<amrex::Real> const& vofR,
     amrex::Vector<amrex::Geometry> geom,
     const amrex::Real dt)
 {
     BL_PROFILE("amr-wind::multiphase::split_compute_fluxes");
-    Box const& bxg1 = amrex::grow(bx, 1);
 
     const Real dx = geom[lev].CellSize(0);
     const Real dy = geom[lev].CellSize(1);
@@ -135,10 +215,6 @@ void multiphase::split_compute_fluxes(
     const auto domlo = amrex::lbound(domain);
     const auto domhi = amrex::ubound(domain);
 
-    Array4<Real> vofL = makeArray4(p, bxg1, 1);
-    p += vofL.size(); // NOLINT: Value not read warning
-    Array4<Real> vofR = makeArray4(p, bxg1, 1);
-
     if (isweep % 3 == 0) {
         sweep_fluxes(2, bx, dtdz, wmac, volfrac, vofL, vofR);
         Box const& zbx = amrex::surroundingNodes(bx, 2);
@@ -169,6 +245,57 @@ void multiphase::split_compute_fluxes(
     }
 }
 
+void multiphase::split_uniform_fluxes(
+    const int lev,
+    amrex::Box const& bx,
+    const int isweep,
+    const bool full,
+    amrex::Array4<amrex::Real const> const& umac,
+    amrex::Array4<amrex::Real const> const& vmac,
+    amrex::Array4<amrex::Real const> const& wmac,
+    amrex::Array4<amrex::Real> const& aax,
+    amrex::Array4<amrex::Real> const& aay,
+    amrex::Array4<amrex::Real> const& aaz,
+    amrex::Array4<amrex::Real> const& fx,
+    amrex::Array4<amrex::Real> const& fy,
+    amrex::Array4<amrex::Real> const& fz,
+    amrex::GpuArray<BC, AMREX_SPACEDIM * 2> BCs,
+    amrex::Vector<amrex::Geometry> geom,
+    const amrex::Real dt)
+{
+    BL_PROFILE("amr-wind::multiphase::split_uniform_fluxes");
+
+    Box const& domain = geom[lev].Domain();
+    const auto domlo = amrex::lbound(domain);
+    const auto domhi = amrex::ubound(domain);
+
+    if (isweep % 3 == 0) {
+        Box const& zbx = amrex::surroundingNodes(bx, 2);
+        amrex::ParallelFor(
+            zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                uniform_fluxes_bc_save(
+                    i, j, k, 2, dt * wmac(i, j, k), full, fz, aaz, BCs,
+                    domlo.z, domhi.z);
+            });
+    } else if (isweep % 3 == 1) {
+        Box const& ybx = amrex::surroundingNodes(bx, 1);
+        amrex::ParallelFor(
+            ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                uniform_fluxes_bc_save(
+                    i, j, k, 1, dt * vmac(i, j, k), full, fy, aay, BCs,
+                    domlo.y, domhi.y);
+            });
+    } else {
+        Box const& xbx = amrex::surroundingNodes(bx, 0);
+        amrex::ParallelFor(
+            xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                uniform_fluxes_bc_save(
+                    i, j, k, 0, dt * umac(i, j, k), full, fx, aax, BCs,
+                    domlo.x, domhi.x);
+            });
+    }
+}
+
 void multiphase::split_compute_sum(
     const int lev,
     amrex::Box const& bx,
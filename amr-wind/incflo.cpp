@@ -7,7 +7,9 @@
 #include "amr-wind/equation_systems/SchemeTraits.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/utilities/PerfTimers.H"
 #include "amr-wind/overset/OversetManager.H"
+#include "amr-wind/core/LoadBalancer.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -161,23 +163,39 @@ void incflo::InitData()
 
 /** Perform regrid actions at a given timestep.
  *
- *  \return Flag indicating if regrid was performed
+ *  \return Flag indicating if the mesh was regridded or rebalanced
  */
 bool incflo::regrid_and_update()
 {
     BL_PROFILE("amr-wind::incflo::regrid_and_update");
+    auto timer = m_sim.perf_timers().scope("regrid");
 
+    bool mesh_changed = false;
     if (m_time.do_regrid()) {
+        // Ensure any background output is complete before the grids change
+        m_sim.io_manager().flush_async_output();
+
         amrex::Print() << "Regrid mesh ... ";
         amrex::Real rstart = amrex::ParallelDescriptor::second();
         regrid(0, m_time.current_time());
         amrex::Real rend = amrex::ParallelDescriptor::second() - rstart;
         amrex::Print() << "time elapsed = " << rend << std::endl;
+        m_sim.perf_timers().add_event("regrid");
         if (ParallelDescriptor::IOProcessor()) {
             amrex::Print() << "Grid summary: " << std::endl;
             printGridSummary(amrex::OutStream(), 0, finest_level);
         }
+        // Measured box times do not apply to the new grids
+        m_sim.load_balancer().reset_timers();
+        mesh_changed = true;
+    }
+
+    if ((mesh_changed && m_sim.load_balancer().balance_on_regrid()) ||
+        m_sim.load_balancer().check_imbalance(m_time.time_index())) {
+        mesh_changed = rebalance(mesh_changed) || mesh_changed;
+    }
 
+    if (mesh_changed) {
         // update mesh map
         {
             if (m_sim.has_mesh_mapping()) {
@@ -214,14 +232,66 @@ bool incflo::regrid_and_update()
     }
 
     // update cell counts if unitialized or if a regrid happened
-    if (m_cell_count == -1 || m_time.do_regrid()) {
+    if (m_cell_count == -1 || mesh_changed) {
         m_cell_count = 0;
         for (int i = 0; i <= finest_level; i++) {
             m_cell_count += boxArray(i).numPts();
         }
     }
 
-    return m_time.do_regrid();
+    return mesh_changed;
+}
+
+/** Redistribute the boxes on each level across MPI ranks
+ *
+ *  Computes the cost of every box using amr_wind::LoadBalancer and remakes the
+ *  levels whose proposed distribution mapping reduces the imbalance. During
+ *  periodic checks (`after_regrid == false`) levels are only rebalanced if the
+ *  current imbalance exceeds the user-defined threshold.
+ *
+ *  \return True if any level was redistributed
+ */
+bool incflo::rebalance(const bool after_regrid)
+{
+    BL_PROFILE("amr-wind::incflo::rebalance");
+    auto& lb = m_sim.load_balancer();
+
+    // Compute the costs of all levels before any level is remade
+    amrex::Vector<amrex::Vector<amrex::Real>> costs(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        costs[lev] = lb.box_costs(lev);
+    }
+
+    bool changed = false;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        const amrex::Real old_imb =
+            amr_wind::LoadBalancer::imbalance(costs[lev], DistributionMap(lev));
+        if (!after_regrid && (old_imb <= lb.imbalance_threshold())) {
+            continue;
+        }
+
+        amrex::DistributionMapping new_dm;
+        const amrex::Real new_imb = lb.propose(costs[lev], lev, new_dm);
+        if ((new_imb >= old_imb) || (new_dm == DistributionMap(lev))) {
+            continue;
+        }
+
+        if (!changed) {
+            m_sim.io_manager().flush_async_output();
+        }
+        amrex::Print() << "Load balance level " << lev
+                       << ": imbalance = " << old_imb << " -> " << new_imb
+                       << std::endl;
+        RemakeLevel(lev, m_time.current_time(), boxArray(lev), new_dm);
+        SetDistributionMap(lev, new_dm);
+        changed = true;
+    }
+
+    lb.reset_timers();
+    if (changed) {
+        m_sim.perf_timers().add_event("rebalance");
+    }
+    return changed;
 }
 
 /** Perform actions after a timestep
@@ -238,17 +308,23 @@ void incflo::post_advance_work()
         pp->post_advance_work();
     }
 
-    m_sim.post_manager().post_advance_work();
+    {
+        auto timer = m_sim.perf_timers().scope("post_processing");
+        m_sim.post_manager().post_advance_work();
+    }
     if (m_verbose > 1) {
         PrintMaxValues("end of timestep");
     }
 
+    auto timer = m_sim.perf_timers().scope("io");
     if (m_time.write_plot_file()) {
         m_sim.io_manager().write_plot_file();
+        m_sim.perf_timers().add_event("plot_file");
     }
 
     if (m_time.write_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
+        m_sim.perf_timers().add_event("checkpoint");
     }
 }
 
@@ -260,8 +336,10 @@ void incflo::Evolve()
 {
     BL_PROFILE("amr-wind::incflo::Evolve()");
 
+    auto& perf = m_sim.perf_timers();
     while (m_time.new_timestep()) {
         amrex::Real time0 = amrex::ParallelDescriptor::second();
+        perf.begin_step();
 
         regrid_and_update();
 
@@ -281,6 +359,9 @@ void incflo::Evolve()
         amrex::Real time2 = amrex::ParallelDescriptor::second();
         post_advance_work();
         amrex::Real time3 = amrex::ParallelDescriptor::second();
+        perf.end_step(
+            m_time.time_index(), m_time.new_time(), m_time.deltaT(),
+            time3 - time0, m_cell_count);
 
         amrex::Print() << "WallClockTime: " << m_time.time_index()
                        << " Pre: " << std::setprecision(3) << (time1 - time0)
@@ -299,6 +380,8 @@ void incflo::Evolve()
                       "========================\n"
                    << std::endl;
 
+    perf.flush_telemetry();
+
     // Output at final time
     if (m_time.write_last_plot_file()) {
         m_sim.io_manager().write_plot_file();
@@ -306,6 +389,19 @@ void incflo::Evolve()
     if (m_time.write_last_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
+    m_sim.io_manager().flush_async_output();
+
+    if (m_sim.repo().use_scratch_pool()) {
+        const auto& stats = m_sim.repo().scratch_pool_stats();
+        amrex::Long peak_bytes = stats.peak_bytes;
+        amrex::ParallelDescriptor::ReduceLongMax(
+            peak_bytes, amrex::ParallelDescriptor::IOProcessorNumber());
+        amrex::Print() << "Scratch field pool: hits = " << stats.num_hits
+                       << " misses = " << stats.num_misses
+                       << " peak memory per rank = "
+                       << static_cast<double>(peak_bytes) / (1024.0 * 1024.0)
+                       << " MB" << std::endl;
+    }
 }
 
 void incflo::do_advance()
@@ -340,6 +436,7 @@ void incflo::MakeNewLevelFromScratch(
     SetDistributionMap(lev, new_dmap);
 
     m_repo.make_new_level_from_scratch(lev, time, new_grids, new_dmap);
+    m_nodal_projector.reset();
 
     // initialize the mesh map before initializing physics
     if (m_sim.has_mesh_mapping()) {
@@ -394,6 +491,9 @@ void incflo::init_physics_and_pde()
     // Initialize the refinement criteria
     m_mesh_refiner->initialize();
 
+    // Initialize the load balancer
+    m_sim.load_balancer().initialize();
+
     // Post-processing actions that need to declare fields
     m_sim.post_manager().pre_init_actions();
 }
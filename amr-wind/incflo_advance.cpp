@@ -7,6 +7,7 @@
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/utilities/PerfTimers.H"
 #include "AMReX_MultiFabUtil.H"
 
 using namespace amrex;
@@ -50,6 +51,7 @@ void incflo::pre_advance_stage2()
 void incflo::advance()
 {
     BL_PROFILE("amr-wind::incflo::Advance");
+    auto timer = m_sim.perf_timers().scope("advance");
 
     m_sim.pde_manager().advance_states();
 
@@ -168,6 +170,7 @@ void incflo::advance()
 void incflo::ApplyPredictor(bool incremental_projection)
 {
     BL_PROFILE("amr-wind::incflo::ApplyPredictor");
+    auto timer = m_sim.perf_timers().scope("predictor");
 
     // We use the new time value for things computed on the "*" state
     Real new_time = m_time.new_time();
@@ -263,7 +266,10 @@ void incflo::ApplyPredictor(bool incremental_projection)
     }
 
     // Extrapolate and apply MAC projection for advection velocities
-    icns().pre_advection_actions(amr_wind::FieldState::Old);
+    {
+        auto mac_timer = m_sim.perf_timers().scope("mac_projection");
+        icns().pre_advection_actions(amr_wind::FieldState::Old);
+    }
 
     // For scalars only first
     // *************************************************************************************
@@ -486,6 +492,7 @@ void incflo::ApplyPredictor(bool incremental_projection)
 void incflo::ApplyCorrector()
 {
     BL_PROFILE("amr-wind::incflo::ApplyCorrector");
+    auto timer = m_sim.perf_timers().scope("corrector");
 
     // We use the new time value for things computed on the "*" state
     Real new_time = m_time.new_time();
@@ -501,7 +508,10 @@ void incflo::ApplyCorrector()
     auto& density_nph = density_new.state(amr_wind::FieldState::NPH);
 
     // Extrapolate and apply MAC projection for advection velocities
-    icns().pre_advection_actions(amr_wind::FieldState::New);
+    {
+        auto mac_timer = m_sim.perf_timers().scope("mac_projection");
+        icns().pre_advection_actions(amr_wind::FieldState::New);
+    }
 
     // *************************************************************************************
     // Compute the explicit "new" advective terms R_u^(n+1,*), R_r^(n+1,*) and
@@ -611,6 +621,7 @@ void incflo::ApplyCorrector()
 void incflo::prescribe_advance()
 {
     BL_PROFILE("amr-wind::incflo::prescribe_advance");
+    auto timer = m_sim.perf_timers().scope("advance");
 
     m_sim.pde_manager().advance_states();
 
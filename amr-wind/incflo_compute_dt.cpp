@@ -36,10 +36,11 @@ void incflo::ComputeDt(bool explicit_diffusion)
 {
     BL_PROFILE("amr-wind::incflo::ComputeDt");
 
-    Real conv_cfl = 0.0;
-    Real diff_cfl = 0.0;
-    Real force_cfl = 0.0;
+    // Convective, diffusive, and forcing CFL over all levels
+    amrex::Array<Real, 3> cfl{0.0, 0.0, 0.0};
     const bool mesh_mapping = m_sim.has_mesh_mapping();
+    const bool has_vof = m_sim.pde_manager().has_pde("VOF");
+    const bool use_force_cfl = m_time.use_force_cfl();
 
     const auto& den = density();
     amr_wind::Field const* mesh_fac =
@@ -55,19 +56,22 @@ void incflo::ComputeDt(bool explicit_diffusion)
         MultiFab const& rho = den(lev);
 
         auto const& vel_arr = vel.const_arrays();
+        auto const& vf_arr = vel_force.const_arrays();
+        auto const& mu_arr = mu.const_arrays();
+        auto const& rho_arr = rho.const_arrays();
         MultiArray4<Real const> fac_arr =
             mesh_mapping ? ((*mesh_fac)(lev).const_arrays())
                          : MultiArray4<Real const>();
-
-        Real conv_lev = 0.0;
-        Real mphase_conv_lev = 0.0;
-        Real diff_lev = 0.0;
-        Real force_lev = 0.0;
-
-        conv_lev += amrex::ParReduce(
-            TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
-            [=] AMREX_GPU_HOST_DEVICE(
-                int box_no, int i, int j, int k) -> GpuTuple<Real> {
+        MultiArray4<Real const> vof_arr =
+            has_vof ? (m_repo.get_field("vof")(lev).const_arrays())
+                    : MultiArray4<Real const>();
+
+        // All limiters are evaluated in a single pass over the level
+        auto const lev_cfl = amrex::ParReduce(
+            TypeList<ReduceOpMax, ReduceOpMax, ReduceOpMax, ReduceOpMax>{},
+            TypeList<Real, Real, Real, Real>{}, vel, IntVect(0),
+            [=] AMREX_GPU_HOST_DEVICE(int box_no, int i, int j, int k)
+                -> GpuTuple<Real, Real, Real, Real> {
                 auto const& v_bx = vel_arr[box_no];
 
                 amrex::Real fac_x =
@@ -77,119 +81,64 @@ void incflo::ComputeDt(bool explicit_diffusion)
                 amrex::Real fac_z =
                     mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
 
-                return amrex::max<amrex::Real>(
-                    std::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x,
-                    std::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y,
-                    std::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z,
-                    static_cast<amrex::Real>(-1.0));
-            });
-
-        if (m_sim.pde_manager().has_pde("VOF")) {
-            MultiFab const& vof = m_repo.get_field("vof")(lev);
-            auto const& vof_arr = vof.const_arrays();
-            mphase_conv_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& v_bx = vel_arr[box_no];
-                    auto const& vof_bx = vof_arr[box_no];
-
-                    // Check for interface
-                    auto is_near =
-                        amr_wind::multiphase::interface_band(i, j, k, vof_bx);
-
-                    // CFL calculation is not needed away from interface
-                    amrex::Real result = 0.0;
-                    if (is_near) {
-                        // Near interface, evaluate CFL by sum of velocities
-                        amrex::Real fac_x =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                        amrex::Real fac_y =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                        amrex::Real fac_z =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                        result = std::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x +
-                                 std::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y +
-                                 std::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z;
-                    }
-                    return result;
-                });
-        }
-        conv_lev = amrex::max(conv_lev, mphase_conv_lev);
-
-        if (explicit_diffusion) {
-            auto const& mu_arr = mu.const_arrays();
-            auto const& rho_arr = rho.const_arrays();
-            diff_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, rho, IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& mu_bx = mu_arr[box_no];
-                    auto const& rho_bx = rho_arr[box_no];
-
-                    amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
+                const amrex::Real ux =
+                    std::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x;
+                const amrex::Real uy =
+                    std::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y;
+                const amrex::Real uz =
+                    std::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z;
+
+                const amrex::Real conv = amrex::max<amrex::Real>(
+                    ux, uy, uz, static_cast<amrex::Real>(-1.0));
+
+                // CFL calculation is not needed away from interface, near
+                // interface evaluate CFL by sum of velocities
+                amrex::Real mphase_conv = 0.0;
+                if (has_vof && amr_wind::multiphase::interface_band(
+                                   i, j, k, vof_arr[box_no])) {
+                    mphase_conv = ux + uy + uz;
+                }
+
+                amrex::Real diff = 0.0;
+                if (explicit_diffusion) {
                     const Real dxinv2 =
                         2.0 * (dxinv[0] / fac_x * dxinv[0] / fac_x +
                                dxinv[1] / fac_y * dxinv[1] / fac_y +
                                dxinv[2] / fac_z * dxinv[2] / fac_z);
-
-                    return amrex::max<amrex::Real>(
-                        mu_bx(i, j, k) * dxinv2 / rho_bx(i, j, k), -1.0);
-                });
-        }
-
-        if (m_time.use_force_cfl()) {
-            auto const& vf_arr = vel_force.const_arrays();
-            auto const& rho_arr = rho.const_arrays();
-            force_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel_force,
-                IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
+                    diff = amrex::max<amrex::Real>(
+                        mu_arr[box_no](i, j, k) * dxinv2 /
+                            rho_arr[box_no](i, j, k),
+                        -1.0);
+                }
+
+                amrex::Real force = 0.0;
+                if (use_force_cfl) {
                     auto const& vf_bx = vf_arr[box_no];
-                    auto const& rho_bx = rho_arr[box_no];
-
-                    amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                    return amrex::max<amrex::Real>(
+                    const amrex::Real rho_ijk = rho_arr[box_no](i, j, k);
+                    force = amrex::max<amrex::Real>(
                         std::abs(vf_bx(i, j, k, 0)) * dxinv[0] / fac_x /
-                            rho_bx(i, j, k),
+                            rho_ijk,
                         std::abs(vf_bx(i, j, k, 1)) * dxinv[1] / fac_y /
-                            rho_bx(i, j, k),
+                            rho_ijk,
                         std::abs(vf_bx(i, j, k, 2)) * dxinv[2] / fac_z /
-                            rho_bx(i, j, k),
+                            rho_ijk,
                         static_cast<amrex::Real>(-1.0));
-                });
-        }
+                }
 
-        conv_cfl = amrex::max(conv_cfl, conv_lev);
-        diff_cfl = amrex::max(diff_cfl, diff_lev);
-        force_cfl = amrex::max(force_cfl, force_lev);
-    }
+                return amrex::makeTuple(conv, mphase_conv, diff, force);
+            });
 
-    ParallelAllReduce::Max<Real>(conv_cfl, ParallelContext::CommunicatorSub());
-    if (explicit_diffusion) {
-        ParallelAllReduce::Max<Real>(
-            diff_cfl, ParallelContext::CommunicatorSub());
-    }
-    if (m_time.use_force_cfl()) {
-        ParallelAllReduce::Max<Real>(
-            force_cfl, ParallelContext::CommunicatorSub());
+        cfl[0] = amrex::max(
+            cfl[0], amrex::get<0>(lev_cfl), amrex::get<1>(lev_cfl));
+        cfl[1] = amrex::max(cfl[1], amrex::get<2>(lev_cfl));
+        cfl[2] = amrex::max(cfl[2], amrex::get<3>(lev_cfl));
     }
 
-    m_time.set_current_cfl(conv_cfl, diff_cfl, force_cfl);
+    ParallelAllReduce::Max<Real>(
+        cfl.data(), static_cast<int>(cfl.size()),
+        ParallelContext::CommunicatorSub());
+
+    m_time.set_current_cfl(cfl[0], cfl[1], cfl[2]);
 }
 
 void incflo::ComputePrescribeDt()
@@ -198,6 +147,7 @@ void incflo::ComputePrescribeDt()
 
     Real conv_cfl = 0.0;
     const bool mesh_mapping = m_sim.has_mesh_mapping();
+    const bool has_vof = m_sim.pde_manager().has_pde("VOF");
 
     amr_wind::Field const* mesh_fac =
         mesh_mapping
@@ -213,15 +163,15 @@ void incflo::ComputePrescribeDt()
         MultiArray4<Real const> fac_arr =
             mesh_mapping ? ((*mesh_fac)(lev).const_arrays())
                          : MultiArray4<Real const>();
+        MultiArray4<Real const> vof_arr =
+            has_vof ? (m_repo.get_field("vof")(lev).const_arrays())
+                    : MultiArray4<Real const>();
 
-        Real conv_lev = 0.0;
-        Real mphase_conv_lev = 0.0;
-
-        conv_lev += amrex::ParReduce(
-            TypeList<ReduceOpMax>{}, TypeList<Real>{},
+        auto const lev_cfl = amrex::ParReduce(
+            TypeList<ReduceOpMax, ReduceOpMax>{}, TypeList<Real, Real>{},
             icns().fields().field(lev), IntVect(0),
             [=] AMREX_GPU_HOST_DEVICE(
-                int box_no, int i, int j, int k) -> GpuTuple<Real> {
+                int box_no, int i, int j, int k) -> GpuTuple<Real, Real> {
                 auto const& umac = uf_arr[box_no];
                 auto const& vmac = vf_arr[box_no];
                 auto const& wmac = wf_arr[box_no];
@@ -233,66 +183,35 @@ void incflo::ComputePrescribeDt()
                 amrex::Real fac_z =
                     mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
 
-                return amrex::max<amrex::Real>(
+                const amrex::Real ux =
                     amrex::max<amrex::Real>(
                         std::abs(umac(i, j, k)), std::abs(umac(i + 1, j, k))) *
-                        dxinv[0] / fac_x,
+                    dxinv[0] / fac_x;
+                const amrex::Real uy =
                     amrex::max<amrex::Real>(
                         std::abs(vmac(i, j, k)), std::abs(vmac(i, j + 1, k))) *
-                        dxinv[1] / fac_y,
+                    dxinv[1] / fac_y;
+                const amrex::Real uz =
                     amrex::max<amrex::Real>(
                         std::abs(wmac(i, j, k)), std::abs(wmac(i, j, k + 1))) *
-                        dxinv[2] / fac_z,
-                    static_cast<amrex::Real>(-1.0));
+                    dxinv[2] / fac_z;
+
+                const amrex::Real conv = amrex::max<amrex::Real>(
+                    ux, uy, uz, static_cast<amrex::Real>(-1.0));
+
+                // CFL calculation is not needed away from interface, near
+                // interface evaluate CFL by sum of velocities
+                amrex::Real mphase_conv = 0.0;
+                if (has_vof && amr_wind::multiphase::interface_band(
+                                   i, j, k, vof_arr[box_no])) {
+                    mphase_conv = ux + uy + uz;
+                }
+
+                return amrex::makeTuple(conv, mphase_conv);
             });
 
-        if (m_sim.pde_manager().has_pde("VOF")) {
-            MultiFab const& vof = m_repo.get_field("vof")(lev);
-            auto const& vof_arr = vof.const_arrays();
-            mphase_conv_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{},
-                icns().fields().field(lev), IntVect(0),
-                [=] AMREX_GPU_HOST_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& vof_bx = vof_arr[box_no];
-                    auto const& umac = uf_arr[box_no];
-                    auto const& vmac = vf_arr[box_no];
-                    auto const& wmac = wf_arr[box_no];
-
-                    // Check for interface
-                    auto is_near =
-                        amr_wind::multiphase::interface_band(i, j, k, vof_bx);
-
-                    // CFL calculation is not needed away from interface
-                    amrex::Real result = 0.0;
-                    if (is_near) {
-                        // Near interface, evaluate CFL by sum of velocities
-                        amrex::Real fac_x =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                        amrex::Real fac_y =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                        amrex::Real fac_z =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                        result = amrex::max(
-                                     std::abs(umac(i, j, k)),
-                                     std::abs(umac(i + 1, j, k))) *
-                                     dxinv[0] / fac_x +
-                                 amrex::max(
-                                     std::abs(vmac(i, j, k)),
-                                     std::abs(vmac(i, j + 1, k))) *
-                                     dxinv[1] / fac_y +
-                                 amrex::max(
-                                     std::abs(wmac(i, j, k)),
-                                     std::abs(wmac(i, j, k + 1))) *
-                                     dxinv[2] / fac_z;
-                    }
-                    return result;
-                });
-        }
-        conv_lev = amrex::max(conv_lev, mphase_conv_lev);
-
-        conv_cfl = amrex::max(conv_cfl, conv_lev);
+        conv_cfl = amrex::max(
+            conv_cfl, amrex::get<0>(lev_cfl), amrex::get<1>(lev_cfl));
     }
 
     ParallelAllReduce::Max<Real>(conv_cfl, ParallelContext::CommunicatorSub());
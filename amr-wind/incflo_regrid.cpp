@@ -16,6 +16,7 @@ void incflo::MakeNewLevelFromCoarse(
     }
 
     m_repo.make_new_level_from_coarse(lev, time, ba, dm);
+    m_nodal_projector.reset();
 }
 
 // Remake an existing level using provided BoxArray and DistributionMapping and
@@ -31,6 +32,7 @@ void incflo::RemakeLevel(
     }
 
     m_repo.remake_level(lev, time, ba, dm);
+    m_nodal_projector.reset();
 }
 
 // Delete level data
@@ -39,4 +41,5 @@ void incflo::ClearLevel(int lev)
 {
     BL_PROFILE("amr-wind::incflo::ClearLevel()");
     m_repo.clear_level(lev);
+    m_nodal_projector.reset();
 }
@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "amr-wind/ocean_waves/relaxation_zones/hos_file_io.H"
+
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Print.H"
+
+namespace amr_wind::ocean_waves::hos {
+
+namespace {
+
+//! Identifier at the start of binary HOS files
+constexpr char binary_magic[8] = {'A', 'W', 'H', 'O', 'S', 'B', '0', '1'};
+
+//! Number of real-valued entries in the binary header
+constexpr int num_header_reals = 6;
+
+//! Number of integer entries in the binary header
+constexpr int num_header_ints = 3;
+
+template <typename T>
+void write_values(std::ofstream& os, const T* data, const size_t n)
+{
+    os.write(reinterpret_cast<const char*>(data), sizeof(T) * n);
+}
+
+template <typename T>
+void read_values(std::ifstream& is, T* data, const size_t n)
+{
+    is.read(reinterpret_cast<char*>(data), sizeof(T) * n);
+}
+
+//! Binary files always store double precision values
+void write_reals(std::ofstream& os, const RealList& vals)
+{
+    if constexpr (std::is_same_v<amrex::Real, double>) {
+        write_values(os, vals.data(), vals.size());
+    } else {
+        const std::vector<double> buf(vals.begin(), vals.end());
+        write_values(os, buf.data(), buf.size());
+    }
+}
+
+void read_reals(std::ifstream& is, RealList& vals)
+{
+    if constexpr (std::is_same_v<amrex::Real, double>) {
+        read_values(is, vals.data(), vals.size());
+    } else {
+        std::vector<double> buf(vals.size());
+        read_values(is, buf.data(), buf.size());
+        std::copy(buf.begin(), buf.end(), vals.begin());
+    }
+}
+
+} // namespace
+
+FileFormat file_format(const std::string& fmt)
+{
+    if (fmt == "ascii") {
+        return FileFormat::Ascii;
+    }
+    if (fmt == "binary") {
+        return FileFormat::Binary;
+    }
+    amrex::Abort(
+        "HOS OceanWaves: invalid file format " + fmt +
+        ". Valid options are: ascii, binary");
+    return FileFormat::Ascii;
+}
+
+void Snapshot::allocate()
+{
+    const auto nlat = static_cast<long>(nx) * ny;
+    eta.resize(nlat);
+    u.resize(nlat * nz);
+    v.resize(nlat * nz);
+    w.resize(nlat * nz);
+}
+
+std::string
+file_name(const std::string& prefix, int lev, int n, FileFormat fmt)
+{
+    std::stringstream fname;
+    fname << prefix << "_lev" << lev << "_" << n
+          << ((fmt == FileFormat::Binary) ? ".bin" : ".txt");
+    return fname.str();
+}
+
+void read_ascii(const std::string& fname, Snapshot& snap)
+{
+    std::ifstream is(fname);
+    if (!is.good()) {
+        amrex::Abort("HOS OceanWaves: cannot open file " + fname);
+    }
+    // Read metadata from file
+    std::string tmp;
+    // Get initial time
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp);
+    snap.t = std::stof(tmp);
+    // Get dt
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp);
+    snap.dt = std::stof(tmp);
+    // Get nx, Lx
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp, ',');
+    snap.nx = std::stoi(tmp);
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp);
+    snap.Lx = std::stof(tmp);
+    // Get ny, Ly
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp, ',');
+    snap.ny = std::stoi(tmp);
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp);
+    snap.Ly = std::stof(tmp);
+    // Get nz, zmin, zmax
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp, ',');
+    snap.nz = std::stoi(tmp);
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp, ',');
+    snap.zmin = std::stof(tmp);
+    std::getline(is, tmp, '=');
+    std::getline(is, tmp);
+    snap.zmax = std::stof(tmp);
+
+    // Allocate arrays for storage
+    snap.allocate();
+    // Skip key
+    std::getline(is, tmp);
+    // Read interface heights and velocities
+    const int nz = snap.nz;
+    for (int ilat = 0; ilat < snap.nx * snap.ny; ++ilat) {
+        // Get eta for current point
+        is >> snap.eta[ilat];
+        // Get u, v, w for full depth of 2D point
+        for (int ivert = 0; ivert < nz; ++ivert) {
+            is >> snap.u[ilat * nz + ivert] >> snap.v[ilat * nz + ivert] >>
+                snap.w[ilat * nz + ivert];
+        }
+    }
+}
+
+void read_binary(const std::string& fname, Snapshot& snap)
+{
+    std::ifstream is(fname, std::ios::in | std::ios::binary);
+    if (!is.good()) {
+        amrex::Abort("HOS OceanWaves: cannot open file " + fname);
+    }
+
+    char magic[sizeof(binary_magic)];
+    read_values(is, magic, sizeof(magic));
+    if (std::memcmp(magic, binary_magic, sizeof(magic)) != 0) {
+        amrex::Abort("HOS OceanWaves: invalid binary HOS file " + fname);
+    }
+
+    double hreal[num_header_reals];
+    std::int32_t hint[num_header_ints];
+    read_values(is, hreal, num_header_reals);
+    read_values(is, hint, num_header_ints);
+    snap.t = hreal[0];
+    snap.dt = hreal[1];
+    snap.Lx = hreal[2];
+    snap.Ly = hreal[3];
+    snap.zmin = hreal[4];
+    snap.zmax = hreal[5];
+    snap.nx = hint[0];
+    snap.ny = hint[1];
+    snap.nz = hint[2];
+
+    snap.allocate();
+    read_reals(is, snap.eta);
+    read_reals(is, snap.u);
+    read_reals(is, snap.v);
+    read_reals(is, snap.w);
+
+    if (!is.good()) {
+        amrex::Abort("HOS OceanWaves: error reading binary HOS file " + fname);
+    }
+}
+
+void write_binary(const std::string& fname, const Snapshot& snap)
+{
+    std::ofstream os(fname, std::ios::out | std::ios::binary);
+    if (!os.good()) {
+        amrex::Abort("HOS OceanWaves: cannot open file " + fname);
+    }
+
+    const double hreal[num_header_reals] = {snap.t,  snap.dt,   snap.Lx,
+                                            snap.Ly, snap.zmin, snap.zmax};
+    const std::int32_t hint[num_header_ints] = {snap.nx, snap.ny, snap.nz};
+    write_values(os, binary_magic, sizeof(binary_magic));
+    write_values(os, hreal, num_header_reals);
+    write_values(os, hint, num_header_ints);
+    write_reals(os, snap.eta);
+    write_reals(os, snap.u);
+    write_reals(os, snap.v);
+    write_reals(os, snap.w);
+
+    if (!os.good()) {
+        amrex::Abort("HOS OceanWaves: error writing binary HOS file " + fname);
+    }
+}
+
+Snapshot read_file(const std::string& fname, FileFormat fmt)
+{
+    Snapshot snap;
+    if (fmt == FileFormat::Binary) {
+        read_binary(fname, snap);
+    } else {
+        read_ascii(fname, snap);
+    }
+    return snap;
+}
+
+void broadcast(Snapshot& snap)
+{
+    BL_PROFILE("amr-wind::ocean_waves::hos::broadcast");
+    const int root = amrex::ParallelDescriptor::IOProcessorNumber();
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+
+    amrex::Real meta[num_header_reals] = {snap.t,  snap.dt,   snap.Lx,
+                                          snap.Ly, snap.zmin, snap.zmax};
+    int dims[num_header_ints] = {snap.nx, snap.ny, snap.nz};
+    amrex::ParallelDescriptor::Bcast(meta, num_header_reals, root, comm);
+    amrex::ParallelDescriptor::Bcast(dims, num_header_ints, root, comm);
+
+    snap.t = meta[0];
+    snap.dt = meta[1];
+    snap.Lx = meta[2];
+    snap.Ly = meta[3];
+    snap.zmin = meta[4];
+    snap.zmax = meta[5];
+    snap.nx = dims[0];
+    snap.ny = dims[1];
+    snap.nz = dims[2];
+
+    snap.allocate();
+    amrex::ParallelDescriptor::Bcast(
+        snap.eta.data(), snap.eta.size(), root, comm);
+    amrex::ParallelDescriptor::Bcast(snap.u.data(), snap.u.size(), root, comm);
+    amrex::ParallelDescriptor::Bcast(snap.v.data(), snap.v.size(), root, comm);
+    amrex::ParallelDescriptor::Bcast(snap.w.data(), snap.w.size(), root, comm);
+}
+
+HOSReader::HOSReader(std::string prefix, FileFormat fmt, bool prefetch)
+    : m_prefix(std::move(prefix)), m_format(fmt), m_prefetch(prefetch)
+{}
+
+HOSReader::~HOSReader() { discard_pending(); }
+
+void HOSReader::discard_pending()
+{
+    for (auto& fut : m_pending) {
+        if (fut.valid()) {
+            fut.wait();
+        }
+    }
+    m_pending.clear();
+    m_pending_n = -1;
+}
+
+void HOSReader::read(int lev, int n, Snapshot& snap)
+{
+    BL_PROFILE("amr-wind::ocean_waves::HOSReader::read");
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        const bool is_pending =
+            (n == m_pending_n) && (lev < static_cast<int>(m_pending.size())) &&
+            m_pending[lev].valid();
+        if (is_pending) {
+            snap = m_pending[lev].get();
+        } else {
+            if (m_pending_n >= 0 && n != m_pending_n) {
+                discard_pending();
+            }
+            snap = read_file(file_name(m_prefix, lev, n, m_format), m_format);
+        }
+    }
+    broadcast(snap);
+}
+
+void HOSReader::prefetch(int nlevels, int n)
+{
+    if (!m_prefetch) {
+        return;
+    }
+
+    discard_pending();
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    m_pending_n = n;
+    m_pending.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto fname = file_name(m_prefix, lev, n, m_format);
+        // Nothing to prefetch beyond the last available snapshot
+        if (!std::ifstream(fname).good()) {
+            continue;
+        }
+        m_pending[lev] = std::async(
+            std::launch::async,
+            [fname, fmt = m_format]() { return read_file(fname, fmt); });
+    }
+}
+
+} // namespace amr_wind::ocean_waves::hos
@@ -8,6 +8,7 @@
 
 #include "AMReX_iMultiFab.H"
 #include "AMReX_MultiFabUtil.H"
+#include "AMReX_ParallelDescriptor.H"
 #include "AMReX_ParmParse.H"
 
 namespace amr_wind {
@@ -101,52 +102,147 @@ namespace {
  *box.
  *
  *. Initializes the dimensions and grid length, sizes in SynthTurbData. Also
- *  allocates the necessary memory for the perturbation velocities.
+ *  allocates the necessary memory for the perturbation velocities. The file is
+ *  only read on the I/O processor and the data is broadcast to all ranks.
  *
  *. @param turbFile Information regarding NetCDF data identifiers
  *. @param turbGrid Turbulence data
+ *. @param window_planes Maximum number of planes held in memory
  */
-void process_nc_file(const std::string& turb_filename, SynthTurbData& turb_grid)
+void process_nc_file(
+    const std::string& turb_filename,
+    SynthTurbData& turb_grid,
+    const int window_planes)
 {
 #ifdef AMR_WIND_USE_NETCDF
-    auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
-
-    // Grid dimensions
-    AMREX_ASSERT(ncf.dim("ndim").len() == AMREX_SPACEDIM);
-    auto nx = ncf.dim("nx").len();
-    auto ny = ncf.dim("ny").len();
-    auto nz = ncf.dim("nz").len();
-
-    turb_grid.box_dims[0] = nx;
-    turb_grid.box_dims[1] = ny;
-    turb_grid.box_dims[2] = nz;
-
-    // Box lengths and resolution
-    auto box_len = ncf.var("box_lengths");
-    box_len.get(turb_grid.box_len.data());
-    auto dx = ncf.var("dx");
-    dx.get(turb_grid.dx.data());
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
+
+        // Grid dimensions
+        AMREX_ALWAYS_ASSERT(ncf.dim("ndim").len() == AMREX_SPACEDIM);
+        turb_grid.box_dims[0] = static_cast<int>(ncf.dim("nx").len());
+        turb_grid.box_dims[1] = static_cast<int>(ncf.dim("ny").len());
+        turb_grid.box_dims[2] = static_cast<int>(ncf.dim("nz").len());
+
+        // Box lengths and resolution
+        auto box_len = ncf.var("box_lengths");
+        box_len.get(turb_grid.box_len.data());
+        auto dx = ncf.var("dx");
+        dx.get(turb_grid.dx.data());
+
+        ncf.close();
+    }
 
-    ncf.close();
+    const int root = amrex::ParallelDescriptor::IOProcessorNumber();
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.box_dims.data(), AMREX_SPACEDIM, root, comm);
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.box_len.data(), AMREX_SPACEDIM, root, comm);
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.dx.data(), AMREX_SPACEDIM, root, comm);
+
+    const int nx = turb_grid.box_dims[0];
+    const int ny = turb_grid.box_dims[1];
+    const int nz = turb_grid.box_dims[2];
+
+    // Planes held in memory, the whole box is kept if it fits in the window
+    AMREX_ALWAYS_ASSERT(window_planes >= 2);
+    turb_grid.win_planes = amrex::min(window_planes, nx);
+    const size_t win_size =
+        static_cast<size_t>(turb_grid.win_planes) * ny * nz;
+    turb_grid.uwin.resize(win_size);
+    turb_grid.vwin.resize(win_size);
+    turb_grid.wwin.resize(win_size);
 
     // Create data structures to store the perturbation velocities for two
     // planes
     const size_t grid_size = 2 * ny * nz;
-    turb_grid.uvel.resize(grid_size);
-    turb_grid.vvel.resize(grid_size);
-    turb_grid.wvel.resize(grid_size);
     turb_grid.uvel_d.resize(grid_size);
     turb_grid.vvel_d.resize(grid_size);
     turb_grid.wvel_d.resize(grid_size);
 #else
-    amrex::ignore_unused(turb_filename, turb_grid);
+    amrex::ignore_unused(turb_filename, turb_grid, window_planes);
+#endif
+}
+
+/** Position of a plane within the window of planes in memory
+ *
+ *  @return Index of the plane in the window, -1 if the plane is not loaded
+ */
+int window_index(const SynthTurbData& turb_grid, const int iplane)
+{
+    if (turb_grid.win_start < 0) {
+        return -1;
+    }
+    const int nx = turb_grid.box_dims[0];
+    const int idx = (iplane - turb_grid.win_start + nx) % nx;
+    return (idx < turb_grid.win_planes) ? idx : -1;
+}
+
+/** Load the window of planes starting at a given plane
+ *
+ *  The planes are read on the I/O processor with at most two reads (when the
+ *  window wraps around the end of the periodic box) and broadcast to all
+ *  ranks.
+ */
+void load_turb_window(
+    const std::string& turb_filename, SynthTurbData& turb_grid, const int is)
+{
+    BL_PROFILE("amr-wind::SyntheticTurbulence::load_window");
+#ifdef AMR_WIND_USE_NETCDF
+    const int nx = turb_grid.box_dims[0];
+    const auto ny = static_cast<size_t>(turb_grid.box_dims[1]);
+    const auto nz = static_cast<size_t>(turb_grid.box_dims[2]);
+    const int nplanes = turb_grid.win_planes;
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
+        auto uvel = ncf.var("uvel");
+        auto vvel = ncf.var("vvel");
+        auto wvel = ncf.var("wvel");
+
+        // Planes up to the end of the box, then the remainder from the start
+        const int nfirst = amrex::min(nplanes, nx - is);
+        std::vector<size_t> start{{static_cast<size_t>(is), 0, 0}};
+        std::vector<size_t> count{{static_cast<size_t>(nfirst), ny, nz}};
+        uvel.get(turb_grid.uwin.data(), start, count);
+        vvel.get(turb_grid.vwin.data(), start, count);
+        wvel.get(turb_grid.wwin.data(), start, count);
+
+        if (nfirst < nplanes) {
+            const size_t offset = nfirst * ny * nz;
+            start[0] = 0;
+            count[0] = static_cast<size_t>(nplanes - nfirst);
+            uvel.get(&turb_grid.uwin[offset], start, count);
+            vvel.get(&turb_grid.vwin[offset], start, count);
+            wvel.get(&turb_grid.wwin[offset], start, count);
+        }
+
+        ncf.close();
+    }
+
+    const int root = amrex::ParallelDescriptor::IOProcessorNumber();
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.uwin.data(), turb_grid.uwin.size(), root, comm);
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.vwin.data(), turb_grid.vwin.size(), root, comm);
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.wwin.data(), turb_grid.wwin.size(), root, comm);
+
+    turb_grid.win_start = is;
+#else
+    amrex::ignore_unused(turb_filename, turb_grid, is);
 #endif
 }
 
 /** Load two planes of data that bound the current timestep
  *
  *  The data for the y and z directions are loaded for the entire grid at the
- * two planes
+ *  two planes. The planes are served from the window of planes in memory; a
+ *  new window starting at the left plane is read from the file only when one
+ *  of the planes is not in the current window.
  */
 void load_turb_plane_data(
     const std::string& turb_filename,
@@ -155,56 +251,31 @@ void load_turb_plane_data(
     const int ir)
 {
     BL_PROFILE("amr-wind::SyntheticTurbulence::load_plane_data");
-#ifdef AMR_WIND_USE_NETCDF
-    auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
-
-    // clang-format off
-    std::vector<size_t> start{{static_cast<size_t>(il), 0, 0}};
-    std::vector<size_t> count{{2, static_cast<size_t>(turb_grid.box_dims[1]),
-                               static_cast<size_t>(turb_grid.box_dims[2])}};
-    // clang-format on
-
-    auto uvel = ncf.var("uvel");
-    auto vvel = ncf.var("vvel");
-    auto wvel = ncf.var("wvel");
+    if ((window_index(turb_grid, il) < 0) ||
+        (window_index(turb_grid, ir) < 0)) {
+        load_turb_window(turb_filename, turb_grid, il);
+    }
 
-    if ((ir - il) == 1) {
-        // two consequtive planes load them in one shot
-        uvel.get(&turb_grid.uvel[0], start, count);
-        vvel.get(&turb_grid.vvel[0], start, count);
-        wvel.get(&turb_grid.wvel[0], start, count);
-    } else {
-        // Load the planes separately
-        count[0] = 1;
-        uvel.get(&turb_grid.uvel[0], start, count);
-        vvel.get(&turb_grid.vvel[0], start, count);
-        wvel.get(&turb_grid.wvel[0], start, count);
-
-        start[0] = static_cast<size_t>(ir);
-        const size_t offset = turb_grid.box_dims[1] * turb_grid.box_dims[2];
-        uvel.get(&turb_grid.uvel[offset], start, count);
-        vvel.get(&turb_grid.vvel[offset], start, count);
-        wvel.get(&turb_grid.wvel[offset], start, count);
+    const size_t nynz = static_cast<size_t>(turb_grid.box_dims[1]) *
+                        static_cast<size_t>(turb_grid.box_dims[2]);
+    const int planes[2] = {il, ir};
+    for (int n = 0; n < 2; ++n) {
+        const size_t src = window_index(turb_grid, planes[n]) * nynz;
+        const size_t dst = n * nynz;
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, turb_grid.uwin.data() + src,
+            turb_grid.uwin.data() + src + nynz, turb_grid.uvel_d.data() + dst);
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, turb_grid.vwin.data() + src,
+            turb_grid.vwin.data() + src + nynz, turb_grid.vvel_d.data() + dst);
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, turb_grid.wwin.data() + src,
+            turb_grid.wwin.data() + src + nynz, turb_grid.wvel_d.data() + dst);
     }
 
     // Update left and right indices for future checks
     turb_grid.ileft = il;
     turb_grid.iright = ir;
-
-    ncf.close();
-
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.uvel.begin(), turb_grid.uvel.end(),
-        turb_grid.uvel_d.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.vvel.begin(), turb_grid.vvel.end(),
-        turb_grid.vvel_d.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.wvel.begin(), turb_grid.wvel.end(),
-        turb_grid.wvel_d.begin());
-#else
-    amrex::ignore_unused(turb_filename, turb_grid, il, ir);
-#endif
 }
 
 /** Determine the left/right indices for a given point along a particular
@@ -366,7 +437,10 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
 
     // NetCDF file containing the turbulence data
     pp.query("turbulence_file", m_turb_filename);
-    process_nc_file(m_turb_filename, m_turb_grid);
+    // Number of planes of the turbulence box held in memory
+    int window_planes = 32;
+    pp.query("window_planes", window_planes);
+    process_nc_file(m_turb_filename, m_turb_grid, window_planes);
 
     // Load position and orientation of the grid
     amrex::Real wind_direction{270.};
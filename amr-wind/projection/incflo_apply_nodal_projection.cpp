@@ -3,6 +3,7 @@
 #include "amr-wind/incflo.H"
 #include "amr-wind/core/MLMGOptions.H"
 #include "amr-wind/utilities/console_io.H"
+#include "amr-wind/utilities/PerfTimers.H"
 #include "amr-wind/core/field_ops.H"
 #include "amr-wind/wind_energy/ABL.H"
 
@@ -110,6 +111,7 @@ void incflo::ApplyProjection(
     bool incremental)
 {
     BL_PROFILE("amr-wind::incflo::ApplyProjection");
+    auto timer = m_sim.perf_timers().scope("nodal_projection");
 
     // If we have dropped the dt substantially for whatever reason,
     // use a different form of the approximate projection that
@@ -297,7 +299,21 @@ void incflo::ApplyProjection(
     }
 
     amr_wind::MLMGOptions options("nodal_proj");
+    bool has_ib = m_sim.physics_manager().contains("IB");
+
+    // With a constant sigma the operator only changes with the mesh, so the
+    // projector (linear operator, coarse levels and bottom solver) is kept
+    // until the next regrid. Solving with the sigma the projector was built
+    // with yields the same projected velocity, while phi and grad(phi) are
+    // scaled by the ratio of the two sigmas.
+    const bool cache_projector = options.reuse_solver && !variable_density &&
+                                 !mesh_mapping && !has_ib &&
+                                 !m_sim.has_overset();
+    if (!cache_projector) {
+        m_nodal_projector.reset();
+    }
 
+    amrex::Real sigma_ratio = 1.0;
     if (variable_density || mesh_mapping) {
         nodal_projector = std::make_unique<Hydro::NodalProjector>(
             vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
@@ -307,20 +323,29 @@ void incflo::ApplyProjection(
         amrex::ParmParse pp("incflo");
         pp.query("density", rho_0);
 
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, scaling_factor / rho_0, Geom(0, finest_level),
-            options.lpinfo());
+        const amrex::Real const_sigma = scaling_factor / rho_0;
+        if (!m_nodal_projector) {
+            nodal_projector = std::make_unique<Hydro::NodalProjector>(
+                vel, const_sigma, Geom(0, finest_level), options.lpinfo());
+            m_nodal_proj_sigma = const_sigma;
+        }
+        sigma_ratio = m_nodal_proj_sigma / const_sigma;
     }
 
-    // Set MLMG and NodalProjector options
-    options(*nodal_projector);
-    nodal_projector->setDomainBC(bclo, bchi);
+    if (nodal_projector) {
+        // Set MLMG and NodalProjector options
+        options(*nodal_projector);
+        nodal_projector->setDomainBC(bclo, bchi);
+        if (cache_projector) {
+            m_nodal_projector = std::move(nodal_projector);
+        }
+    }
+    auto& nproj = cache_projector ? *m_nodal_projector : *nodal_projector;
 
-    bool has_ib = m_sim.physics_manager().contains("IB");
     if (has_ib) {
         auto div_vel_rhs =
             sim().repo().create_scratch_field(1, 0, amr_wind::FieldLoc::NODE);
-        nodal_projector->computeRHS(div_vel_rhs->vec_ptrs(), vel, {}, {});
+        nproj.computeRHS(div_vel_rhs->vec_ptrs(), vel, {}, {});
         // Mask the righ-hand side of the Poisson solve for the nodes inside the
         // body
         const auto& imask_node = repo().get_int_field("mask_node");
@@ -329,19 +354,19 @@ void incflo::ApplyProjection(
                 *div_vel_rhs->vec_ptrs()[lev],
                 amrex::ToMultiFab(imask_node(lev)), 0, 0, 1, 0);
         }
-        nodal_projector->setCustomRHS(div_vel_rhs->vec_const_ptrs());
+        nproj.setCustomRHS(div_vel_rhs->vec_const_ptrs());
     }
 
     // Setup masking for overset simulations
     if (sim().has_overset()) {
-        auto& linop = nodal_projector->getLinOp();
+        auto& linop = nproj.getLinOp();
         const auto& imask_node = repo().get_int_field("mask_node");
         for (int lev = 0; lev <= finest_level; ++lev) {
             linop.setOversetMask(lev, imask_node(lev));
         }
     }
 
-    if (m_sim.has_overset()) {
+    if (m_sim.has_overset() || cache_projector) {
         auto phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::NODE);
         if (incremental) {
             for (int lev = 0; lev <= finestLevel(); ++lev) {
@@ -351,13 +376,26 @@ void incflo::ApplyProjection(
             amr_wind::field_ops::copy(*phif, pressure, 0, 0, 1, 1);
         }
 
-        nodal_projector->project(
-            phif->vec_ptrs(), options.rel_tol, options.abs_tol);
+        // The cached projector solves for phi / sigma_ratio, so the previous
+        // pressure (without the reference pressure) is scaled accordingly
+        if (cache_projector && !incremental) {
+            if (m_repo.field_exists("reference_pressure") && time != 0.0) {
+                auto& p0 = m_repo.get_field("reference_pressure");
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    amrex::MultiFab::Subtract(
+                        (*phif)(lev), p0(lev), 0, 0, 1, 1);
+                }
+            }
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                (*phif)(lev).mult(1.0 / sigma_ratio, 0, 1, 1);
+            }
+        }
+
+        nproj.project(phif->vec_ptrs(), options.rel_tol, options.abs_tol);
     } else {
-        nodal_projector->project(options.rel_tol, options.abs_tol);
+        nproj.project(options.rel_tol, options.abs_tol);
     }
-    amr_wind::io::print_mlmg_info(
-        "Nodal_projection", nodal_projector->getMLMG());
+    amr_wind::io::print_mlmg_info("Nodal_projection", nproj.getMLMG());
 
     // scale U^* back to -> U = fac/J * U^bar
     if (mesh_mapping) {
@@ -373,8 +411,8 @@ void incflo::ApplyProjection(
     }
 
     // Get phi and fluxes
-    auto phi = nodal_projector->getPhi();
-    auto gradphi = nodal_projector->getGradPhi();
+    auto phi = nproj.getPhi();
+    auto gradphi = nproj.getGradPhi();
 
     for (int lev = 0; lev <= finest_level; lev++) {
 
@@ -392,21 +430,21 @@ void incflo::ApplyProjection(
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) += gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) += sigma_ratio * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) += p_proj(i, j, k);
+                        p_lev(i, j, k) += sigma_ratio * p_proj(i, j, k);
                     });
             } else {
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) = gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) = sigma_ratio * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) = p_proj(i, j, k);
+                        p_lev(i, j, k) = sigma_ratio * p_proj(i, j, k);
                     });
             }
         }
@@ -29,6 +29,11 @@ void incflo::ReadParameters()
         // Godunov-related flags
         pp.query("use_godunov", m_use_godunov);
 
+        // Recycle scratch field allocations between calls
+        bool use_scratch_pool = m_sim.repo().use_scratch_pool();
+        pp.query("use_scratch_pool", use_scratch_pool);
+        m_sim.repo().set_scratch_pool(use_scratch_pool);
+
         // The default for diffusion_type is 1, i.e. the default m_diff_type is
         // DiffusionType::Crank_Nicolson
         int diffusion_type = 1;
@@ -0,0 +1,418 @@
+#include "amr-wind/utilities/FusedPlaneAveraging.H"
+
+#include <algorithm>
+
+namespace amr_wind {
+
+int FusedPlaneAveraging::register_field(FieldPlaneAveraging& pa)
+{
+    for (const auto& fi : m_fields) {
+        if (fi.pa == &pa) {
+            return fi.offset;
+        }
+    }
+
+    if (m_fields.empty()) {
+        m_axis = pa.axis();
+        m_level = pa.level();
+        m_ncell_line = pa.ncell_line();
+        m_ncell_plane = pa.ncell_plane();
+    }
+    AMREX_ALWAYS_ASSERT(pa.axis() == m_axis);
+    AMREX_ALWAYS_ASSERT(pa.level() == m_level);
+    AMREX_ALWAYS_ASSERT(pa.ncell_line() == m_ncell_line);
+    AMREX_ALWAYS_ASSERT(pa.ncell_plane() == m_ncell_plane);
+    AMREX_ALWAYS_ASSERT(static_cast<int>(m_fields.size()) < max_fields);
+    AMREX_ALWAYS_ASSERT(m_ncomp + pa.ncomp() <= max_comps);
+
+    FieldInfo fi;
+    fi.pa = &pa;
+    fi.offset = m_ncomp;
+    m_fields.push_back(fi);
+    m_ncomp += pa.ncomp();
+
+    for (int n = 0; n < pa.ncomp(); ++n) {
+        add_term(Mean, fi.offset + n);
+    }
+    return fi.offset;
+}
+
+int FusedPlaneAveraging::field_offset(const FieldPlaneAveraging& pa) const
+{
+    for (const auto& fi : m_fields) {
+        if (fi.pa == &pa) {
+            return fi.offset;
+        }
+    }
+    amrex::Abort(
+        "FusedPlaneAveraging: field " + pa.field().name() +
+        " must be registered before its moments");
+    return -1;
+}
+
+void FusedPlaneAveraging::add(FieldPlaneAveraging& pa) { register_field(pa); }
+
+void FusedPlaneAveraging::add(VelPlaneAveraging& pa)
+{
+    const int offset = register_field(pa);
+    for (auto& fi : m_fields) {
+        if (fi.pa == &pa) {
+            fi.vel = &pa;
+        }
+    }
+
+    const int h1 = (m_axis == 0) ? 1 : 0;
+    const int h2 = (m_axis == 2) ? 1 : 2;
+    add_term(HVelMag, offset + h1, offset + h2);
+}
+
+void FusedPlaneAveraging::add(SecondMomentAveraging& sm)
+{
+    const int o1 = field_offset(sm.m_plane_average1);
+    const int o2 = field_offset(sm.m_plane_average2);
+    const int nc1 = sm.m_plane_average1.ncomp();
+    const int nc2 = sm.m_plane_average2.ncomp();
+
+    for (int m = 0; m < nc1; ++m) {
+        for (int n = 0; n < nc2; ++n) {
+            add_term(Pair, o1 + m, o2 + n);
+        }
+    }
+    m_second.push_back(&sm);
+}
+
+void FusedPlaneAveraging::add(ThirdMomentAveraging& tm)
+{
+    const int o1 = field_offset(tm.m_plane_average1);
+    const int o2 = field_offset(tm.m_plane_average2);
+    const int o3 = field_offset(tm.m_plane_average3);
+    const int nc1 = tm.m_plane_average1.ncomp();
+    const int nc2 = tm.m_plane_average2.ncomp();
+    const int nc3 = tm.m_plane_average3.ncomp();
+
+    for (int m = 0; m < nc1; ++m) {
+        for (int n = 0; n < nc2; ++n) {
+            for (int p = 0; p < nc3; ++p) {
+                const int a = o1 + m;
+                const int b = o2 + n;
+                const int c = o3 + p;
+                // Pairs are required to convert to central moments
+                add_term(Pair, a, b);
+                add_term(Pair, a, c);
+                add_term(Pair, b, c);
+                add_term(Triple, a, b, c);
+            }
+        }
+    }
+    m_third.push_back(&tm);
+}
+
+FusedPlaneAveraging::TermKey
+FusedPlaneAveraging::make_key(TermType type, int a, int b, int c)
+{
+    // Products are commutative, so sort the indices to share the terms
+    TermKey key{{type, a, b, c}};
+    const int nsort = (type == Triple) ? 3 : ((type == Pair) ? 2 : 0);
+    std::sort(key.begin() + 1, key.begin() + 1 + nsort);
+    return key;
+}
+
+void FusedPlaneAveraging::add_term(TermType type, int a, int b, int c)
+{
+    const auto key = make_key(type, a, b, c);
+    if (m_term_map.find(key) != m_term_map.end()) {
+        return;
+    }
+
+    if ((type == Mean) || (type == HVelMag)) {
+        // Plane averages are always stored first so that updating them alone
+        // only requires reducing the leading portion of the sums array
+        const auto idx = static_cast<int>(m_first_terms.size());
+        m_first_terms.push_back(key);
+        for (auto& it : m_term_map) {
+            if (it.second >= idx) {
+                ++it.second;
+            }
+        }
+        m_term_map[key] = idx;
+    } else {
+        m_term_map[key] = static_cast<int>(
+            m_first_terms.size() + m_moment_terms.size());
+        m_moment_terms.push_back(key);
+    }
+}
+
+int FusedPlaneAveraging::term_index(TermType type, int a, int b, int c) const
+{
+    return m_term_map.at(make_key(type, a, b, c));
+}
+
+void FusedPlaneAveraging::operator()(const bool compute_moments)
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::operator");
+
+    if (m_fields.empty()) {
+        return;
+    }
+
+    const int nterms = num_terms(compute_moments);
+    amrex::Vector<int> terms;
+    terms.reserve(static_cast<size_t>(nterms) * 4);
+    for (const auto& key : m_first_terms) {
+        terms.insert(terms.end(), key.begin(), key.end());
+    }
+    if (compute_moments) {
+        for (const auto& key : m_moment_terms) {
+            terms.insert(terms.end(), key.begin(), key.end());
+        }
+    }
+
+    // Shift each component by the plane averages from the previous update
+    amrex::Vector<amrex::Real> shift(
+        static_cast<size_t>(m_ncomp) * m_ncell_line, 0.0);
+    for (const auto& fi : m_fields) {
+        const auto& lavg = fi.pa->line_average();
+        const int nc = fi.pa->ncomp();
+        for (int n = 0; n < nc; ++n) {
+            for (int i = 0; i < m_ncell_line; ++i) {
+                shift[(fi.offset + n) * m_ncell_line + i] = lavg[nc * i + n];
+            }
+        }
+    }
+
+    amrex::Vector<amrex::Real> sums(
+        static_cast<size_t>(nterms) * m_ncell_line, 0.0);
+
+    switch (m_axis) {
+    case 0:
+        compute_sums(XDir(), terms, shift, sums);
+        break;
+    case 1:
+        compute_sums(YDir(), terms, shift, sums);
+        break;
+    case 2:
+        compute_sums(ZDir(), terms, shift, sums);
+        break;
+    default:
+        amrex::Abort("axis must be equal to 0, 1, or 2");
+        break;
+    }
+
+    update_objects(compute_moments, shift, sums);
+}
+
+template <typename IndexSelector>
+void FusedPlaneAveraging::compute_sums(
+    const IndexSelector& idxOp,
+    const amrex::Vector<int>& terms,
+    const amrex::Vector<amrex::Real>& shift,
+    amrex::Vector<amrex::Real>& sums)
+{
+    BL_PROFILE("amr-wind::FusedPlaneAveraging::compute_sums");
+
+    const amrex::Real denom = 1.0 / (amrex::Real)m_ncell_plane;
+    const auto nterms = static_cast<int>(terms.size() / 4);
+    const int ncomp = m_ncomp;
+    const int ncell_line = m_ncell_line;
+    const auto nfields = static_cast<int>(m_fields.size());
+
+    amrex::AsyncArray<int> dterms(terms.data(), terms.size());
+    amrex::AsyncArray<amrex::Real> dshift(shift.data(), shift.size());
+    amrex::AsyncArray<amrex::Real> dsums(sums.data(), sums.size());
+    const int* term_defs = dterms.data();
+    const amrex::Real* line_shift = dshift.data();
+    amrex::Real* line_sums = dsums.data();
+
+    amrex::GpuArray<int, max_fields> fcomp{{0}};
+    amrex::GpuArray<int, max_fields> foffset{{0}};
+    for (int f = 0; f < nfields; ++f) {
+        fcomp[f] = m_fields[f].pa->ncomp();
+        foffset[f] = m_fields[f].offset;
+    }
+
+    const auto& mfab0 = m_fields[0].pa->field()(m_level);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mfab0, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        amrex::Box bx = mfi.tilebox();
+
+        amrex::GpuArray<amrex::Array4<const amrex::Real>, max_fields> farrs;
+        for (int f = 0; f < nfields; ++f) {
+            farrs[f] = m_fields[f].pa->field()(m_level).const_array(mfi);
+        }
+
+        amrex::Box pbx =
+            PerpendicularBox<IndexSelector>(bx, amrex::IntVect{0, 0, 0});
+
+        amrex::ParallelFor(
+            amrex::Gpu::KernelInfo().setReduction(true), pbx,
+            [=] AMREX_GPU_DEVICE(
+                int p_i, int p_j, int p_k,
+                amrex::Gpu::Handler const& handler) noexcept {
+                // Loop over the direction perpendicular to the plane.
+                // This reduces the atomic pressure on the destination arrays.
+
+                amrex::Box lbx = ParallelBox<IndexSelector>(
+                    bx, amrex::IntVect{p_i, p_j, p_k});
+
+                for (int k = lbx.smallEnd(2); k <= lbx.bigEnd(2); ++k) {
+                    for (int j = lbx.smallEnd(1); j <= lbx.bigEnd(1); ++j) {
+                        for (int i = lbx.smallEnd(0); i <= lbx.bigEnd(0); ++i) {
+
+                            const int ind = idxOp(i, j, k);
+
+                            amrex::Real val[max_comps];
+                            amrex::Real fluc[max_comps];
+                            for (int f = 0; f < nfields; ++f) {
+                                for (int n = 0; n < fcomp[f]; ++n) {
+                                    val[foffset[f] + n] = farrs[f](i, j, k, n);
+                                }
+                            }
+                            for (int n = 0; n < ncomp; ++n) {
+                                fluc[n] =
+                                    val[n] - line_shift[n * ncell_line + ind];
+                            }
+
+                            for (int t = 0; t < nterms; ++t) {
+                                const int* td = &term_defs[4 * t];
+                                amrex::Real tval;
+                                switch (td[0]) {
+                                case Mean:
+                                    tval = fluc[td[1]];
+                                    break;
+                                case HVelMag:
+                                    tval = std::sqrt(
+                                        val[td[1]] * val[td[1]] +
+                                        val[td[2]] * val[td[2]]);
+                                    break;
+                                case Pair:
+                                    tval = fluc[td[1]] * fluc[td[2]];
+                                    break;
+                                default:
+                                    tval =
+                                        fluc[td[1]] * fluc[td[2]] * fluc[td[3]];
+                                    break;
+                                }
+                                amrex::Gpu::deviceReduceSum(
+                                    &line_sums[t * ncell_line + ind],
+                                    tval * denom, handler);
+                            }
+                        }
+                    }
+                }
+            });
+    }
+
+    dsums.copyToHost(sums.data(), sums.size());
+    amrex::ParallelDescriptor::ReduceRealSum(
+        sums.data(), static_cast<int>(sums.size()));
+}
+
+void FusedPlaneAveraging::update_objects(
+    const bool compute_moments,
+    const amrex::Vector<amrex::Real>& shift,
+    const amrex::Vector<amrex::Real>& sums)
+{
+    const int nline = m_ncell_line;
+    const auto sum = [&](const int term, const int ind) {
+        return sums[term * nline + ind];
+    };
+
+    for (const auto& fi : m_fields) {
+        auto& pa = *fi.pa;
+        const int nc = pa.ncomp();
+        for (int n = 0; n < nc; ++n) {
+            const int term = term_index(Mean, fi.offset + n);
+            for (int i = 0; i < nline; ++i) {
+                pa.m_line_average[nc * i + n] =
+                    shift[(fi.offset + n) * nline + i] + sum(term, i);
+            }
+        }
+        pa.m_last_updated_index = pa.m_time.time_index();
+        if (pa.m_comp_deriv) {
+            pa.compute_line_derivatives();
+        }
+
+        if (fi.vel != nullptr) {
+            auto& vel = *fi.vel;
+            const int h1 = (m_axis == 0) ? 1 : 0;
+            const int h2 = (m_axis == 2) ? 1 : 2;
+            const int term =
+                term_index(HVelMag, fi.offset + h1, fi.offset + h2);
+            for (int i = 0; i < nline; ++i) {
+                vel.m_line_hvelmag_average[i] = sum(term, i);
+            }
+            if (vel.m_comp_deriv) {
+                vel.compute_line_hvelmag_derivatives();
+            }
+        }
+    }
+
+    if (!compute_moments) {
+        return;
+    }
+
+    // Mean of the deviation from the shift for a given component
+    const auto dmean = [&](const int comp, const int ind) {
+        return sum(term_index(Mean, comp), ind);
+    };
+    const auto pair = [&](const int a, const int b, const int ind) {
+        return sum(term_index(Pair, a, b), ind);
+    };
+
+    for (auto* sm : m_second) {
+        const int o1 = field_offset(sm->m_plane_average1);
+        const int o2 = field_offset(sm->m_plane_average2);
+        const int nc1 = sm->m_plane_average1.ncomp();
+        const int nc2 = sm->m_plane_average2.ncomp();
+        const int nmom = sm->m_num_moments;
+
+        for (int i = 0; i < nline; ++i) {
+            for (int m = 0; m < nc1; ++m) {
+                for (int n = 0; n < nc2; ++n) {
+                    const int a = o1 + m;
+                    const int b = o2 + n;
+                    sm->m_second_moments_line[nmom * i + nc2 * m + n] =
+                        pair(a, b, i) - dmean(a, i) * dmean(b, i);
+                }
+            }
+        }
+        sm->m_last_updated_index = sm->m_plane_average1.last_updated_index();
+    }
+
+    for (auto* tm : m_third) {
+        const int o1 = field_offset(tm->m_plane_average1);
+        const int o2 = field_offset(tm->m_plane_average2);
+        const int o3 = field_offset(tm->m_plane_average3);
+        const int nc1 = tm->m_plane_average1.ncomp();
+        const int nc2 = tm->m_plane_average2.ncomp();
+        const int nc3 = tm->m_plane_average3.ncomp();
+        const int nmom = tm->m_num_moments;
+
+        for (int i = 0; i < nline; ++i) {
+            for (int m = 0; m < nc1; ++m) {
+                for (int n = 0; n < nc2; ++n) {
+                    for (int p = 0; p < nc3; ++p) {
+                        const int a = o1 + m;
+                        const int b = o2 + n;
+                        const int c = o3 + p;
+                        const amrex::Real ma = dmean(a, i);
+                        const amrex::Real mb = dmean(b, i);
+                        const amrex::Real mc = dmean(c, i);
+                        tm->m_third_moments_line
+                            [nmom * i + nc2 * nc3 * m + nc3 * n + p] =
+                            sum(term_index(Triple, a, b, c), i) -
+                            ma * pair(b, c, i) - mb * pair(a, c, i) -
+                            mc * pair(a, b, i) + 2.0 * ma * mb * mc;
+                    }
+                }
+            }
+        }
+        tm->m_last_updated_index = tm->m_plane_average1.last_updated_index();
+    }
+}
+
+} // namespace amr_wind
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <ctime>
 #include <fstream>
+#include <memory>
 
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/CFDSim.H"
@@ -15,6 +16,8 @@
 #include "AMReX_ParmParse.H"
 #include "AMReX_PlotFileUtil.H"
 #include "AMReX_MultiFabUtil.H"
+#include "AMReX_AsyncOut.H"
+#include "AMReX_VisMF.H"
 
 #ifdef AMR_WIND_USE_HDF5
 #include "AMReX_PlotFileUtilHDF5.H"
@@ -26,7 +29,7 @@ IOManager::IOManager(CFDSim& sim)
     : m_sim(sim), m_derived_mgr(new DerivedQtyMgr(m_sim.repo()))
 {}
 
-IOManager::~IOManager() = default;
+IOManager::~IOManager() { flush_async_output(); }
 
 void IOManager::initialize_io()
 {
@@ -44,6 +47,8 @@ void IOManager::initialize_io()
     pp.query("check_file", m_chk_prefix);
     pp.query("restart_file", m_restart_file);
     pp.query("allow_missing_restart_fields", m_allow_missing_restart_fields);
+    pp.query("async_output", m_async_output);
+    pp.query("async_max_pending", m_max_pending_outputs);
 #ifdef AMR_WIND_USE_HDF5
     pp.query("output_hdf5_plotfile", m_output_hdf5_plotfile);
 #ifdef AMR_WIND_USE_HDF5_ZFP
@@ -85,6 +90,14 @@ void IOManager::initialize_io()
 
     amrex::Print() << "Initializing I/O manager" << std::endl;
 
+    if (m_async_output && !amrex::AsyncOut::UseAsyncOut()) {
+        amrex::Print() << "  WARNING: io.async_output requires amrex.async_out "
+                          "= 1; falling back to synchronous output"
+                       << std::endl;
+        m_async_output = false;
+    }
+    AMREX_ALWAYS_ASSERT(m_max_pending_outputs > 0);
+
     // Process output variables information
     auto& repo = m_sim.repo();
     m_plt_num_comp = 0;
@@ -172,10 +185,13 @@ void IOManager::write_plot_file()
         );
     } else {
 #endif
+        // With asynchronous output enabled, AMReX stages a copy of the data so
+        // the scratch field can be released as soon as this call returns
         amrex::WriteMultiLevelPlotfile(
             plt_filename, nlevels, outfield->vec_const_ptrs(), m_plt_var_names,
             mesh.Geom(), m_sim.time().new_time(), istep, mesh.refRatio());
         write_info_file(plt_filename);
+        track_async_output();
 #ifdef AMR_WIND_USE_HDF5
     }
 #endif
@@ -199,12 +215,49 @@ void IOManager::write_checkpoint_file(const int start_level)
     for (int lev = start_level; lev < mesh.finestLevel() + 1; ++lev) {
         for (auto* fld : m_chk_fields) {
             auto& field = *fld;
-            amrex::VisMF::Write(
-                field(lev),
-                amrex::MultiFabFileFullPrefix(
-                    lev - start_level, chkname, level_prefix, field.name()));
+            const auto mf_name = amrex::MultiFabFileFullPrefix(
+                lev - start_level, chkname, level_prefix, field.name());
+            if (m_async_output) {
+                // Stages a copy of the data and returns immediately
+                amrex::VisMF::AsyncWrite(field(lev), mf_name);
+            } else {
+                amrex::VisMF::Write(field(lev), mf_name);
+            }
         }
     }
+    track_async_output();
+}
+
+void IOManager::track_async_output()
+{
+    if (!m_async_output) {
+        return;
+    }
+
+    // The background queue is processed in order, so this marker completes
+    // only after every write submitted for the current output has finished.
+    auto done = std::make_shared<std::promise<void>>();
+    m_pending_outputs.push_back(done->get_future());
+    amrex::AsyncOut::Submit([done]() { done->set_value(); });
+
+    while (static_cast<int>(m_pending_outputs.size()) > m_max_pending_outputs) {
+        BL_PROFILE("amr-wind::IOManager::wait_async_output");
+        m_pending_outputs.front().wait();
+        m_pending_outputs.pop_front();
+    }
+}
+
+void IOManager::flush_async_output()
+{
+    if (m_pending_outputs.empty()) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::IOManager::flush_async_output");
+    for (auto& fut : m_pending_outputs) {
+        fut.wait();
+    }
+    m_pending_outputs.clear();
 }
 
 void IOManager::read_checkpoint_fields(
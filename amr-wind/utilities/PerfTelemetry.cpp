@@ -0,0 +1,497 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+#include "amr-wind/utilities/PerfTelemetry.H"
+#include "amr-wind/utilities/io_utils.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Print.H"
+#include "AMReX_Utility.H"
+
+namespace amr_wind {
+
+namespace {
+
+const std::string telemetry_dir = "post_processing";
+
+//! Telemetry of a set of timesteps after reduction across all ranks
+struct TelemetryData
+{
+    amrex::Vector<int> step;
+    amrex::Vector<double> time;
+    amrex::Vector<double> dt;
+    amrex::Vector<double> wall_time;
+    amrex::Vector<double> num_cells;
+    amrex::Vector<double> resident_hwm;
+    amrex::Vector<double> fab_memory;
+
+    //! Phase times indexed by [phase][row]
+    amrex::Vector<amrex::Vector<double>> phase_max;
+    amrex::Vector<amrex::Vector<double>> phase_avg;
+
+    //! Solver iterations indexed by [solver][row]
+    amrex::Vector<amrex::Vector<int>> solver_iters;
+
+    //! Event counts indexed by [event][row]
+    amrex::Vector<amrex::Vector<int>> events;
+};
+
+/** Reduce the buffered records across all ranks
+ *
+ *  The returned data is only valid on the I/O rank.
+ */
+TelemetryData gather(
+    const amrex::Vector<PerfTimers::StepRecord>& records,
+    const int nphases,
+    const int nsolvers,
+    const int nevents)
+{
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    const int nrows = static_cast<int>(records.size());
+    const int ncols = nphases + 1;
+
+    amrex::Vector<double> tmax(nrows * ncols, 0.0);
+    amrex::Vector<amrex::Long> mem(2 * nrows, 0);
+    for (int n = 0; n < nrows; ++n) {
+        const auto& rec = records[n];
+        tmax[n * ncols] = rec.wall_time;
+        const int np =
+            std::min(nphases, static_cast<int>(rec.phase_times.size()));
+        for (int ip = 0; ip < np; ++ip) {
+            tmax[n * ncols + ip + 1] = rec.phase_times[ip];
+        }
+        mem[2 * n] = rec.resident_hwm;
+        mem[2 * n + 1] = rec.fab_memory;
+    }
+    auto tsum = tmax;
+    amrex::ParallelDescriptor::ReduceRealMax(
+        tmax.data(), nrows * ncols, ioproc);
+    amrex::ParallelDescriptor::ReduceRealSum(
+        tsum.data(), nrows * ncols, ioproc);
+    amrex::ParallelDescriptor::ReduceLongMax(mem.data(), 2 * nrows, ioproc);
+
+    TelemetryData data;
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return data;
+    }
+
+    const double nprocs = amrex::ParallelDescriptor::NProcs();
+    data.phase_max.resize(nphases, amrex::Vector<double>(nrows));
+    data.phase_avg.resize(nphases, amrex::Vector<double>(nrows));
+    data.solver_iters.resize(nsolvers, amrex::Vector<int>(nrows, 0));
+    data.events.resize(nevents, amrex::Vector<int>(nrows, 0));
+    for (int n = 0; n < nrows; ++n) {
+        const auto& rec = records[n];
+        data.step.push_back(rec.step);
+        data.time.push_back(rec.time);
+        data.dt.push_back(rec.dt);
+        data.wall_time.push_back(tmax[n * ncols]);
+        data.num_cells.push_back(static_cast<double>(rec.num_cells));
+        data.resident_hwm.push_back(static_cast<double>(mem[2 * n]));
+        data.fab_memory.push_back(static_cast<double>(mem[2 * n + 1]));
+        for (int ip = 0; ip < nphases; ++ip) {
+            data.phase_max[ip][n] = tmax[n * ncols + ip + 1];
+            data.phase_avg[ip][n] = tsum[n * ncols + ip + 1] / nprocs;
+        }
+
+        // Solves and events are collective, so they are identical on all ranks
+        const int ns =
+            std::min(nsolvers, static_cast<int>(rec.solver_iters.size()));
+        for (int is = 0; is < ns; ++is) {
+            data.solver_iters[is][n] = rec.solver_iters[is];
+        }
+        const int ne =
+            std::min(nevents, static_cast<int>(rec.event_counts.size()));
+        for (int ie = 0; ie < ne; ++ie) {
+            data.events[ie][n] = rec.event_counts[ie];
+        }
+    }
+    return data;
+}
+
+/** Check that the phases are registered on all ranks
+ *
+ *  Registration order is identical on all ranks, but guard against phases
+ *  that are only timed on a subset of the ranks.
+ */
+void check_phases(const amrex::Vector<std::string>& phases)
+{
+    int nphases = static_cast<int>(phases.size());
+    int nmin = nphases;
+    amrex::ParallelDescriptor::ReduceIntMin(nmin);
+    amrex::ParallelDescriptor::ReduceIntMax(nphases);
+    AMREX_ALWAYS_ASSERT(nmin == nphases);
+}
+
+void write_csv(const std::string& fname, const TelemetryData& data)
+{
+    std::ofstream outfile(fname, std::ios_base::out | std::ios_base::app);
+    outfile << std::setprecision(8);
+    const int nrows = static_cast<int>(data.step.size());
+    for (int n = 0; n < nrows; ++n) {
+        outfile << data.step[n] << "," << std::setprecision(12) << data.time[n]
+                << "," << data.dt[n] << std::setprecision(8) << ","
+                << data.wall_time[n] << "," << data.num_cells[n] << ","
+                << data.resident_hwm[n] << "," << data.fab_memory[n];
+        for (const auto& col : data.phase_max) {
+            outfile << "," << col[n];
+        }
+        for (const auto& col : data.phase_avg) {
+            outfile << "," << col[n];
+        }
+        for (const auto& col : data.solver_iters) {
+            outfile << "," << col[n];
+        }
+        for (const auto& col : data.events) {
+            outfile << "," << col[n];
+        }
+        outfile << "\n";
+    }
+    if (!outfile.good()) {
+        amrex::Abort("PerfTelemetry: error writing " + fname);
+    }
+}
+
+void write_netcdf(
+    const std::string& fname,
+    const TelemetryData& data,
+    const amrex::Vector<std::string>& phases,
+    const amrex::Vector<std::string>& solvers,
+    const amrex::Vector<std::string>& events)
+{
+#ifdef AMR_WIND_USE_NETCDF
+    auto ncf = ncutils::NCFile::open(fname, NC_WRITE);
+    const std::string nt_name = "num_time_steps";
+    const size_t nt = ncf.dim(nt_name).len();
+    const std::vector<size_t> start{nt};
+    const std::vector<size_t> count{data.step.size()};
+
+    ncf.var("step").put(data.step.data(), start, count);
+    ncf.var("time").put(data.time.data(), start, count);
+    ncf.var("dt").put(data.dt.data(), start, count);
+    ncf.var("wall_time").put(data.wall_time.data(), start, count);
+    ncf.var("num_cells").put(data.num_cells.data(), start, count);
+    ncf.var("resident_hwm").put(data.resident_hwm.data(), start, count);
+    ncf.var("fab_memory").put(data.fab_memory.data(), start, count);
+
+    {
+        auto grp_max = ncf.group("phase_time_max");
+        auto grp_avg = ncf.group("phase_time_avg");
+        for (int ip = 0; ip < static_cast<int>(phases.size()); ++ip) {
+            grp_max.var(phases[ip]).put(
+                data.phase_max[ip].data(), start, count);
+            grp_avg.var(phases[ip]).put(
+                data.phase_avg[ip].data(), start, count);
+        }
+    }
+    {
+        auto grp = ncf.group("solver_iterations");
+        for (int is = 0; is < static_cast<int>(solvers.size()); ++is) {
+            grp.var(solvers[is]).put(
+                data.solver_iters[is].data(), start, count);
+        }
+    }
+    {
+        auto grp = ncf.group("events");
+        for (int ie = 0; ie < static_cast<int>(events.size()); ++ie) {
+            grp.var(events[ie]).put(data.events[ie].data(), start, count);
+        }
+    }
+    ncf.close();
+#else
+    amrex::ignore_unused(fname, data, phases, solvers, events);
+#endif
+}
+
+} // namespace
+
+PerfTelemetry::PerfTelemetry(std::string format, const int interval)
+    : m_format(std::move(format)), m_interval(interval)
+{
+    if ((m_format != "csv") && (m_format != "netcdf")) {
+        amrex::Abort(
+            "PerfTelemetry: invalid perf.telemetry_format = " + m_format +
+            ". Valid options are: none, csv, netcdf");
+    }
+#ifndef AMR_WIND_USE_NETCDF
+    if (m_format == "netcdf") {
+        amrex::Abort(
+            "NetCDF support was not enabled during build time. Please "
+            "recompile or use csv format");
+    }
+#endif
+    AMREX_ALWAYS_ASSERT(m_interval > 0);
+}
+
+void PerfTelemetry::record(
+    const PerfTimers& timers, const PerfTimers::StepRecord& rec)
+{
+    m_pending.push_back(rec);
+    if (static_cast<int>(m_pending.size()) >= m_interval) {
+        flush(timers);
+    }
+}
+
+void PerfTelemetry::flush(const PerfTimers& timers)
+{
+    BL_PROFILE("amr-wind::PerfTelemetry::flush");
+    if (m_pending.empty()) {
+        return;
+    }
+    if (!m_prepared) {
+        prepare(timers);
+    } else {
+        add_columns(timers);
+    }
+
+    const auto data = gather(
+        m_pending, static_cast<int>(m_phases.size()),
+        static_cast<int>(m_solvers.size()),
+        static_cast<int>(m_events.size()));
+    m_pending.clear();
+
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+    if (m_format == "csv") {
+        write_csv(m_filename, data);
+    } else {
+        write_netcdf(m_filename, data, m_phases, m_solvers, m_events);
+    }
+}
+
+void PerfTelemetry::prepare(const PerfTimers& timers)
+{
+    BL_PROFILE("amr-wind::PerfTelemetry::prepare");
+    m_phases = timers.phase_names();
+    m_solvers = timers.solver_names();
+    m_events = timers.event_names();
+    check_phases(m_phases);
+
+    const std::string sname =
+        amrex::Concatenate("perf_telemetry", m_pending.front().step - 1);
+    m_filename = telemetry_dir + "/" + sname +
+                 ((m_format == "csv") ? ".csv" : ".nc");
+    m_prepared = true;
+
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+    if (!amrex::UtilCreateDirectory(telemetry_dir, 0755)) {
+        amrex::CreateDirectoryFailed(telemetry_dir);
+    }
+    if (m_format == "csv") {
+        prepare_csv();
+    } else {
+        prepare_netcdf();
+    }
+}
+
+void PerfTelemetry::write_csv_header(std::ostream& os) const
+{
+    os << "step,time,dt,wall_time,num_cells,resident_hwm,fab_memory";
+    for (const auto& name : m_phases) {
+        os << "," << name << "_max";
+    }
+    for (const auto& name : m_phases) {
+        os << "," << name << "_avg";
+    }
+    for (const auto& name : m_solvers) {
+        os << "," << name << "_iters";
+    }
+    for (const auto& name : m_events) {
+        os << "," << name;
+    }
+    os << "\n";
+}
+
+void PerfTelemetry::prepare_csv() const
+{
+    std::ofstream outfile(m_filename, std::ios_base::out);
+    write_csv_header(outfile);
+}
+
+void PerfTelemetry::prepare_netcdf() const
+{
+#ifdef AMR_WIND_USE_NETCDF
+    auto ncf = ncutils::NCFile::create(m_filename, NC_CLOBBER | NC_NETCDF4);
+    const std::string nt_name = "num_time_steps";
+    const std::vector<std::string> one_dim{nt_name};
+
+    ncf.enter_def_mode();
+    ncf.put_attr("title", "AMR-Wind performance telemetry");
+    ncf.put_attr("version", ioutils::amr_wind_version());
+    ncf.put_attr("created_on", ioutils::timestamp());
+    ncf.def_dim(nt_name, NC_UNLIMITED);
+    ncf.def_var("step", NC_INT, one_dim);
+    ncf.def_var("time", NC_DOUBLE, one_dim);
+    ncf.def_var("dt", NC_DOUBLE, one_dim);
+    ncf.def_var("wall_time", NC_DOUBLE, one_dim);
+    ncf.def_var("num_cells", NC_DOUBLE, one_dim);
+    ncf.def_var("resident_hwm", NC_DOUBLE, one_dim);
+    ncf.def_var("fab_memory", NC_DOUBLE, one_dim);
+
+    auto grp_max = ncf.def_group("phase_time_max");
+    auto grp_avg = ncf.def_group("phase_time_avg");
+    for (const auto& name : m_phases) {
+        grp_max.def_var(name, NC_DOUBLE, one_dim);
+        grp_avg.def_var(name, NC_DOUBLE, one_dim);
+    }
+    auto grp_solver = ncf.def_group("solver_iterations");
+    for (const auto& name : m_solvers) {
+        grp_solver.def_var(name, NC_INT, one_dim);
+    }
+    auto grp_events = ncf.def_group("events");
+    for (const auto& name : m_events) {
+        grp_events.def_var(name, NC_INT, one_dim);
+    }
+    ncf.exit_def_mode();
+#endif
+}
+
+void PerfTelemetry::add_columns(const PerfTimers& timers)
+{
+    BL_PROFILE("amr-wind::PerfTelemetry::add_columns");
+    // Solves and events are collective, so only the phases can differ across
+    // ranks and this check makes the decision below identical on all ranks
+    check_phases(timers.phase_names());
+    if ((timers.phase_names().size() == m_phases.size()) &&
+        (timers.solver_names().size() == m_solvers.size()) &&
+        (timers.event_names().size() == m_events.size())) {
+        return;
+    }
+
+    const int nphases_old = static_cast<int>(m_phases.size());
+    const int nsolvers_old = static_cast<int>(m_solvers.size());
+    const int nevents_old = static_cast<int>(m_events.size());
+
+    // Names are only ever appended, so the existing columns keep their order
+    m_phases = timers.phase_names();
+    m_solvers = timers.solver_names();
+    m_events = timers.event_names();
+
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+    if (m_format == "csv") {
+        add_columns_csv(nphases_old, nsolvers_old, nevents_old);
+    } else {
+        add_columns_netcdf(nphases_old, nsolvers_old, nevents_old);
+    }
+}
+
+void PerfTelemetry::add_columns_csv(
+    const int nphases_old, const int nsolvers_old, const int nevents_old) const
+{
+    amrex::Vector<std::string> rows;
+    {
+        std::ifstream infile(m_filename);
+        std::string line;
+        // Skip the old header
+        std::getline(infile, line);
+        while (std::getline(infile, line)) {
+            rows.push_back(line);
+        }
+    }
+
+    const int nphases = static_cast<int>(m_phases.size());
+    const int nsolvers = static_cast<int>(m_solvers.size());
+    const int nevents = static_cast<int>(m_events.size());
+    const int nbase = 7;
+
+    std::ofstream outfile(m_filename, std::ios_base::out);
+    write_csv_header(outfile);
+    for (const auto& row : rows) {
+        amrex::Vector<std::string> cols;
+        std::istringstream ss(row);
+        std::string col;
+        while (std::getline(ss, col, ',')) {
+            cols.push_back(col);
+        }
+        AMREX_ALWAYS_ASSERT(
+            static_cast<int>(cols.size()) ==
+            nbase + 2 * nphases_old + nsolvers_old + nevents_old);
+
+        // Copy the existing columns of a block and pad it with zeros
+        int offset = 1;
+        auto write_block = [&](const int nold, const int nnew) {
+            for (int i = 0; i < nold; ++i) {
+                outfile << "," << cols[offset + i];
+            }
+            for (int i = nold; i < nnew; ++i) {
+                outfile << ",0";
+            }
+            offset += nold;
+        };
+        outfile << cols[0];
+        write_block(nbase - 1, nbase - 1);
+        write_block(nphases_old, nphases);
+        write_block(nphases_old, nphases);
+        write_block(nsolvers_old, nsolvers);
+        write_block(nevents_old, nevents);
+        outfile << "\n";
+    }
+    if (!outfile.good()) {
+        amrex::Abort("PerfTelemetry: error writing " + m_filename);
+    }
+}
+
+void PerfTelemetry::add_columns_netcdf(
+    const int nphases_old, const int nsolvers_old, const int nevents_old) const
+{
+#ifdef AMR_WIND_USE_NETCDF
+    auto ncf = ncutils::NCFile::open(m_filename, NC_WRITE);
+    const std::string nt_name = "num_time_steps";
+    const std::vector<std::string> one_dim{nt_name};
+    const size_t nt = ncf.dim(nt_name).len();
+
+    auto grp_max = ncf.group("phase_time_max");
+    auto grp_avg = ncf.group("phase_time_avg");
+    auto grp_solver = ncf.group("solver_iterations");
+    auto grp_events = ncf.group("events");
+
+    ncf.enter_def_mode();
+    for (int ip = nphases_old; ip < static_cast<int>(m_phases.size()); ++ip) {
+        grp_max.def_var(m_phases[ip], NC_DOUBLE, one_dim);
+        grp_avg.def_var(m_phases[ip], NC_DOUBLE, one_dim);
+    }
+    for (int is = nsolvers_old; is < static_cast<int>(m_solvers.size());
+         ++is) {
+        grp_solver.def_var(m_solvers[is], NC_INT, one_dim);
+    }
+    for (int ie = nevents_old; ie < static_cast<int>(m_events.size()); ++ie) {
+        grp_events.def_var(m_events[ie], NC_INT, one_dim);
+    }
+    ncf.exit_def_mode();
+
+    // Rows written before the columns existed are zero
+    if (nt > 0) {
+        const std::vector<size_t> start{0};
+        const std::vector<size_t> count{nt};
+        const std::vector<double> dzeros(nt, 0.0);
+        const std::vector<int> izeros(nt, 0);
+        for (int ip = nphases_old; ip < static_cast<int>(m_phases.size());
+             ++ip) {
+            grp_max.var(m_phases[ip]).put(dzeros.data(), start, count);
+            grp_avg.var(m_phases[ip]).put(dzeros.data(), start, count);
+        }
+        for (int is = nsolvers_old; is < static_cast<int>(m_solvers.size());
+             ++is) {
+            grp_solver.var(m_solvers[is]).put(izeros.data(), start, count);
+        }
+        for (int ie = nevents_old; ie < static_cast<int>(m_events.size());
+             ++ie) {
+            grp_events.var(m_events[ie]).put(izeros.data(), start, count);
+        }
+    }
+    ncf.close();
+#else
+    amrex::ignore_unused(nphases_old, nsolvers_old, nevents_old);
+#endif
+}
+
+} // namespace amr_wind
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <utility>
+
+#include "amr-wind/utilities/PerfTimers.H"
+#include "amr-wind/utilities/PerfTelemetry.H"
+
+#include "AMReX_FArrayBox.H"
+#include "AMReX_Gpu.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_ParmParse.H"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace amr_wind {
+
+namespace {
+
+//! Iterations of the linear solves since the start of the current timestep
+amrex::Vector<std::pair<std::string, int>>& solver_log()
+{
+    static amrex::Vector<std::pair<std::string, int>> log;
+    return log;
+}
+
+} // namespace
+
+PerfTimers::Scope::Scope(PerfTimers* timers, const int id)
+    : m_timers(timers), m_id(id)
+{
+    if (m_timers != nullptr) {
+        if (m_timers->m_gpu_sync) {
+            amrex::Gpu::streamSynchronize();
+        }
+        m_start = amrex::ParallelDescriptor::second();
+    }
+}
+
+PerfTimers::Scope::~Scope()
+{
+    if (m_timers != nullptr) {
+        if (m_timers->m_gpu_sync) {
+            amrex::Gpu::streamSynchronize();
+        }
+        m_timers->add_time(m_id, amrex::ParallelDescriptor::second() - m_start);
+    }
+}
+
+PerfTimers::PerfTimers()
+{
+    amrex::ParmParse pp("perf");
+    pp.query("timers", m_enabled);
+    pp.query("gpu_sync", m_gpu_sync);
+    pp.query("keep_history", m_keep_history);
+
+    std::string fmt{"none"};
+    pp.query("telemetry_format", fmt);
+    if (fmt != "none") {
+        int interval = 10;
+        pp.query("telemetry_interval", interval);
+        m_telemetry = std::make_unique<PerfTelemetry>(fmt, interval);
+        m_enabled = true;
+    }
+}
+
+PerfTimers::~PerfTimers() = default;
+
+int PerfTimers::phase_id(const std::string& name)
+{
+    const auto found = m_ids.find(name);
+    if (found != m_ids.end()) {
+        return found->second;
+    }
+
+    const int id = static_cast<int>(m_names.size());
+    m_names.push_back(name);
+    m_ids[name] = id;
+    m_step_times.push_back(0.0);
+    return id;
+}
+
+int PerfTimers::solver_id(const std::string& name)
+{
+    const auto found = m_solver_ids.find(name);
+    if (found != m_solver_ids.end()) {
+        return found->second;
+    }
+
+    const int id = static_cast<int>(m_solver_names.size());
+    m_solver_names.push_back(name);
+    m_solver_ids[name] = id;
+    return id;
+}
+
+void PerfTimers::add_event(const std::string& name)
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    const auto found = m_event_ids.find(name);
+    if (found != m_event_ids.end()) {
+        ++m_step_events[found->second];
+        return;
+    }
+
+    const int id = static_cast<int>(m_event_names.size());
+    m_event_names.push_back(name);
+    m_event_ids[name] = id;
+    m_step_events.push_back(1);
+}
+
+void PerfTimers::add_time(const int id, const double elapsed)
+{
+    m_step_times[id] += elapsed;
+}
+
+void PerfTimers::begin_step()
+{
+    std::fill(m_step_times.begin(), m_step_times.end(), 0.0);
+    std::fill(m_step_events.begin(), m_step_events.end(), 0);
+    solver_log().clear();
+}
+
+void PerfTimers::end_step(
+    const int step,
+    const amrex::Real time,
+    const amrex::Real dt,
+    const double wall_time,
+    const amrex::Long num_cells)
+{
+    if (!m_enabled || (!m_keep_history && !m_telemetry)) {
+        return;
+    }
+
+    StepRecord rec;
+    rec.step = step;
+    rec.time = time;
+    rec.dt = dt;
+    rec.wall_time = wall_time;
+    rec.num_cells = num_cells;
+    rec.resident_hwm = perf::resident_memory_hwm();
+    rec.fab_memory = perf::fab_memory();
+    rec.phase_times = m_step_times;
+    rec.event_counts = m_step_events;
+    for (const auto& solve : solver_log()) {
+        const int id = solver_id(solve.first);
+        if (id >= static_cast<int>(rec.solver_iters.size())) {
+            rec.solver_iters.resize(id + 1, 0);
+        }
+        rec.solver_iters[id] += solve.second;
+    }
+    solver_log().clear();
+
+    if (m_telemetry) {
+        m_telemetry->record(*this, rec);
+    }
+    if (m_keep_history) {
+        m_history.push_back(std::move(rec));
+    }
+}
+
+void PerfTimers::flush_telemetry()
+{
+    if (m_telemetry) {
+        m_telemetry->flush(*this);
+    }
+}
+
+namespace perf {
+
+amrex::Long resident_memory_hwm()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        // macOS reports the peak resident set size in bytes
+        return static_cast<amrex::Long>(usage.ru_maxrss);
+#else
+        // Linux reports the peak resident set size in kilobytes
+        return static_cast<amrex::Long>(usage.ru_maxrss) * 1024;
+#endif
+    }
+#endif
+    return 0;
+}
+
+amrex::Long fab_memory_hwm()
+{
+    return static_cast<amrex::Long>(amrex::TotalBytesAllocatedInFabsHWM());
+}
+
+amrex::Long fab_memory()
+{
+    return static_cast<amrex::Long>(amrex::TotalBytesAllocatedInFabs());
+}
+
+void record_solver_iterations(const std::string& name, const int num_iters)
+{
+    auto& log = solver_log();
+    for (auto& solve : log) {
+        if (solve.first == name) {
+            solve.second += num_iters;
+            return;
+        }
+    }
+    log.emplace_back(name, num_iters);
+}
+
+} // namespace perf
+
+} // namespace amr_wind
@@ -1,6 +1,7 @@
 #include <chrono>
 #include <ctime>
 #include "amr-wind/utilities/console_io.H"
+#include "amr-wind/utilities/PerfTimers.H"
 #include "amr-wind/AMRWindVersion.H"
 #include "AMReX.H"
 
@@ -166,6 +167,8 @@ void print_mlmg_header(const std::string& key)
 
 void print_mlmg_info(const std::string& solve_name, const amrex::MLMG& mlmg)
 {
+    perf::record_solver_iterations(solve_name, mlmg.getNumIters());
+
     const int name_width = 26;
     amrex::Print() << "  " << std::setw(name_width) << std::left << solve_name
                    << std::setw(6) << std::right << mlmg.getNumIters()
@@ -280,6 +280,12 @@ void NCVar::par_access(const int cmode) const
     check_nc_error(nc_var_par_access(ncid, varid, cmode));
 }
 
+void NCVar::def_deflate(const bool shuffle, const int level) const
+{
+    check_nc_error(nc_def_var_deflate(
+        ncid, varid, static_cast<int>(shuffle), 1, level));
+}
+
 std::string NCGroup::name() const
 {
     size_t nlen;
@@ -526,6 +532,16 @@ void NCGroup::enter_def_mode() const
 
 void NCGroup::exit_def_mode() const { check_nc_error(nc_enddef(ncid)); }
 
+void NCGroup::par_access(const int cmode) const
+{
+    for (const auto& var : all_vars()) {
+        var.par_access(cmode);
+    }
+    for (const auto& grp : all_groups()) {
+        grp.par_access(cmode);
+    }
+}
+
 NCFile NCFile::create(const std::string& name, const int cmode)
 {
     int ncid;
@@ -561,6 +577,8 @@ NCFile::~NCFile()
     if (is_open) check_nc_error(nc_close(ncid));
 }
 
+void NCFile::sync() const { check_nc_error(nc_sync(ncid)); }
+
 void NCFile::close()
 {
     is_open = false;
@@ -1,6 +1,7 @@
 #include "amr-wind/utilities/sampling/FreeSurface.H"
 #include "amr-wind/utilities/io_utils.H"
 #include <AMReX_MultiFabUtil.H>
+#include <algorithm>
 #include <utility>
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 #include "amr-wind/equation_systems/vof/volume_fractions.H"
@@ -350,12 +351,11 @@ void FreeSurface::post_advance_work()
     }
 
     // Zero data in output array
-    for (int n = 0; n < m_npts * m_ninst; n++) {
-        m_out[n] = 0.0;
-    }
+    std::fill(m_out.begin(), m_out.end(), 0.0);
     // Set up device vector of current outputs, initialize to plo
     const auto& plo0 = m_sim.mesh().Geom(0).ProbLoArray();
-    amrex::Gpu::DeviceVector<amrex::Real> dout(m_npts, plo0[m_coorddir]);
+    const amrex::Real out_init = plo0[m_coorddir];
+    amrex::Gpu::DeviceVector<amrex::Real> dout(m_npts, out_init);
     auto* dout_ptr = dout.data();
     // Set up device vector of last outputs, initialize to above phi0
     const auto& phi0 = m_sim.mesh().Geom(0).ProbHiArray();
@@ -522,22 +522,26 @@ void FreeSurface::post_advance_work()
         }
 
         // Copy information back from device
+        auto* out_ptr = &m_out[static_cast<long>(ni) * m_npts];
         amrex::Gpu::copy(
-            amrex::Gpu::deviceToHost, dout.begin(), dout.end(),
-            &m_out[static_cast<long>(ni) * m_npts]);
-        // Make consistent across parallelization
-        for (int n = 0; n < m_npts; n++) {
-            amrex::ParallelDescriptor::ReduceRealMax(m_out[ni * m_npts + n]);
-        }
-        // Copy last m_out to device vector of results of last instance
-        amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, &m_out[static_cast<long>(ni) * m_npts],
-            &m_out[(ni + 1) * m_npts - 1] + 1, dout_last.begin());
-        // Reset current output device vector
-        for (int n = 0; n < m_npts; n++) {
-            dout_ptr[n] = plo0[m_coorddir];
+            amrex::Gpu::deviceToHost, dout.begin(), dout.end(), out_ptr);
+        // Make consistent across parallelization with a single reduction for
+        // all the points of this instance
+        amrex::ParallelDescriptor::ReduceRealMax(out_ptr, m_npts);
+
+        // Subsequent instances are searched below the current one, which is
+        // only needed (and copied back to device) if there are more instances
+        if (ni + 1 < m_ninst) {
+            amrex::Gpu::copyAsync(
+                amrex::Gpu::hostToDevice, out_ptr, out_ptr + m_npts,
+                dout_last.begin());
+            // Reset current output device vector
+            amrex::ParallelFor(m_npts, [=] AMREX_GPU_DEVICE(int n) noexcept {
+                dout_ptr[n] = out_init;
+            });
         }
     }
+    amrex::Gpu::streamSynchronize();
 
     process_output();
 }
@@ -30,6 +30,7 @@ void Sampling::initialize()
         pp.getarr("fields", field_names);
         pp.query("output_frequency", m_out_freq);
         pp.query("output_format", m_out_fmt);
+        pp.query("parallel_netcdf", m_par_netcdf);
     }
 
     // Process field information
@@ -183,17 +184,50 @@ void Sampling::prepare_netcdf_file()
     }
     m_ncfile_name = post_dir + "/" + sname + ".nc";
 
+    if (m_par_netcdf) {
+        // All ranks participate in the file creation and the file is kept open
+        // for the remainder of the simulation
+        m_ncf = std::make_unique<ncutils::NCFile>(ncutils::NCFile::create_par(
+            m_ncfile_name, NC_CLOBBER | NC_NETCDF4 | NC_MPIIO,
+            amrex::ParallelDescriptor::Communicator(), MPI_INFO_NULL));
+        define_netcdf_file(*m_ncf);
+        m_ncf->par_access(NC_COLLECTIVE);
+        populate_netcdf_metadata(*m_ncf);
+        m_ncf->sync();
+        return;
+    }
+
     // Only I/O processor handles NetCDF generation
     if (!amrex::ParallelDescriptor::IOProcessor()) return;
 
     auto ncf = ncutils::NCFile::create(m_ncfile_name, NC_CLOBBER | NC_NETCDF4);
+    define_netcdf_file(ncf);
+    populate_netcdf_metadata(ncf);
+
+#else
+    amrex::Abort(
+        "NetCDF support was not enabled during build time. Please recompile or "
+        "use native format");
+#endif
+}
+
+void Sampling::define_netcdf_file(const ncutils::NCFile& ncf)
+{
+#ifdef AMR_WIND_USE_NETCDF
     const std::string nt_name = "num_time_steps";
     const std::string npart_name = "num_points";
     const std::vector<std::string> two_dim{nt_name, npart_name};
+    // Metadata must be identical on all ranks for parallel I/O
+    std::string tstamp = ioutils::timestamp();
+    if (m_par_netcdf) {
+        amrex::ParallelDescriptor::Bcast(
+            tstamp.data(), tstamp.size(),
+            amrex::ParallelDescriptor::IOProcessorNumber());
+    }
     ncf.enter_def_mode();
     ncf.put_attr("title", "AMR-Wind data sampling output");
     ncf.put_attr("version", ioutils::amr_wind_version());
-    ncf.put_attr("created_on", ioutils::timestamp());
+    ncf.put_attr("created_on", tstamp);
     ncf.def_dim(nt_name, NC_UNLIMITED);
     ncf.def_dim("ndim", AMREX_SPACEDIM);
     ncf.def_var("time", NC_DOUBLE, {nt_name});
@@ -208,7 +242,14 @@ void Sampling::prepare_netcdf_file()
             grp.def_var(vname, NC_DOUBLE, two_dim);
     }
     ncf.exit_def_mode();
+#else
+    amrex::ignore_unused(ncf);
+#endif
+}
 
+void Sampling::populate_netcdf_metadata(const ncutils::NCFile& ncf)
+{
+#ifdef AMR_WIND_USE_NETCDF
     {
         const std::vector<size_t> start{0, 0};
         std::vector<size_t> count{0, AMREX_SPACEDIM};
@@ -222,17 +263,19 @@ void Sampling::prepare_netcdf_file()
             xyz.put(&locs[0][0], start, count);
         }
     }
-
 #else
-    amrex::Abort(
-        "NetCDF support was not enabled during build time. Please recompile or "
-        "use native format");
+    amrex::ignore_unused(ncf);
 #endif
 }
 
 void Sampling::write_netcdf()
 {
 #ifdef AMR_WIND_USE_NETCDF
+    if (m_par_netcdf) {
+        write_netcdf_par();
+        return;
+    }
+
     std::vector<double> buf(m_total_particles * m_var_names.size(), 0.0);
     m_scontainer->populate_buffer(buf);
 
@@ -276,4 +319,63 @@ void Sampling::write_netcdf()
 #endif
 }
 
+/** Write sampled data collectively to the NetCDF file kept open by all ranks
+ *
+ *  Each rank writes the hyperslab corresponding to its contiguous range of
+ *  probe UIDs. The sampler specific data (time, coordinates) is replicated
+ *  on all ranks and written collectively.
+ */
+void Sampling::write_netcdf_par()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    BL_PROFILE("amr-wind::Sampling::write_netcdf_par");
+    std::vector<double> buf;
+    m_scontainer->populate_local_buffer(buf);
+    const auto range = m_scontainer->local_uid_range();
+    const int nrange = range.second - range.first;
+
+    auto& ncf = *m_ncf;
+    const std::string nt_name = "num_time_steps";
+    // Index of the next timestep
+    const size_t nt = ncf.dim(nt_name).len();
+    {
+        auto time = m_sim.time().new_time();
+        ncf.var("time").put(&time, {nt}, {1});
+    }
+
+    for (const auto& obj : m_samplers) {
+        auto grp = ncf.group(obj->label());
+        obj->output_netcdf_data(grp, nt);
+    }
+
+    std::vector<size_t> start{nt, 0};
+    std::vector<size_t> count{1, 0};
+
+    const int nvars = m_var_names.size();
+    for (int iv = 0; iv < nvars; ++iv) {
+        int soffset = 0;
+        for (const auto& obj : m_samplers) {
+            auto grp = ncf.group(obj->label());
+            auto var = grp.var(m_var_names[iv]);
+
+            // Portion of this sampler that is written by this rank
+            const int npts = obj->num_points();
+            const int lo = amrex::max(soffset, range.first);
+            const int hi = amrex::min(soffset + npts, range.second);
+            if (hi > lo) {
+                start[1] = lo - soffset;
+                count[1] = hi - lo;
+            } else {
+                start[1] = 0;
+                count[1] = 0;
+            }
+            const int boffset = iv * nrange + amrex::max(lo - range.first, 0);
+            var.put(buf.data() + boffset, start, count);
+            soffset += npts;
+        }
+    }
+    ncf.sync();
+#endif
+}
+
 } // namespace amr_wind::sampling
@@ -222,37 +222,226 @@ void SamplingContainer::interpolate_fields(const amrex::Vector<Field*> fields)
     }
 }
 
-void SamplingContainer::populate_buffer(std::vector<double>& buf)
+void SamplingContainer::pack_particle_data(
+    std::vector<int>& uids, std::vector<double>& vals)
 {
-    BL_PROFILE("amr-wind::SamplingContainer::populate_buffer");
-
-    amrex::Gpu::DeviceVector<double> dbuf(buf.size(), 0.0);
-    auto* dbuf_ptr = dbuf.data();
+    const int ncomp = NumRuntimeRealComps();
     const int nlevels = m_mesh.finestLevel() + 1;
+
+    int num_local = 0;
     for (int lev = 0; lev < nlevels; ++lev) {
-        for (int fid = 0; fid < NumRuntimeRealComps(); ++fid) {
-            const int offset = fid * num_sampling_particles();
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            num_local += pti.numParticles();
+        }
+    }
+
+    amrex::Gpu::DeviceVector<int> duid(num_local);
+    amrex::Gpu::DeviceVector<double> dval(
+        static_cast<size_t>(num_local) * ncomp);
+    {
+        auto* duid_ptr = duid.data();
+        auto* dval_ptr = dval.data();
+        int poffset = 0;
+        for (int lev = 0; lev < nlevels; ++lev) {
             for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
                 const int np = pti.numParticles();
                 auto* pstruct = pti.GetArrayOfStructs()().data();
-                auto* parr = pti.GetStructOfArrays().GetRealData(fid).data();
-
                 amrex::ParallelFor(
                     np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
-                        auto& pp = pstruct[ip];
-                        const int pidx = pp.idata(IIx::uid);
-                        const int ii = offset + pidx;
-                        dbuf_ptr[ii] = parr[ip];
+                        duid_ptr[poffset + ip] = pstruct[ip].idata(IIx::uid);
                     });
+
+                for (int fid = 0; fid < ncomp; ++fid) {
+                    auto* parr =
+                        pti.GetStructOfArrays().GetRealData(fid).data();
+                    amrex::ParallelFor(
+                        np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                            dval_ptr[(poffset + ip) * ncomp + fid] = parr[ip];
+                        });
+                }
+                poffset += np;
             }
         }
     }
 
+    uids.resize(num_local);
+    vals.resize(static_cast<size_t>(num_local) * ncomp);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, duid.begin(), duid.end(), uids.begin());
     amrex::Gpu::copy(
-        amrex::Gpu::deviceToHost, dbuf.begin(), dbuf.end(), buf.begin());
-    amrex::ParallelDescriptor::ReduceRealSum(
-        buf.data(), static_cast<int>(buf.size()),
-        amrex::ParallelDescriptor::IOProcessorNumber());
+        amrex::Gpu::deviceToHost, dval.begin(), dval.end(), vals.begin());
+}
+
+/** Gather the sampled data from all MPI ranks into a buffer on the IO rank
+ *
+ *  Each rank packs only the particles it owns as (uid, values) pairs and ships
+ *  them to the IO rank, which then scatters them into the buffer ordered by
+ *  field and particle UID. The communication volume scales with the total
+ *  number of probes instead of the number of probes times the number of ranks.
+ *  The buffer contents are only valid on the IO rank.
+ */
+void SamplingContainer::populate_buffer(std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::populate_buffer");
+
+    const int ncomp = NumRuntimeRealComps();
+    std::vector<int> luid;
+    std::vector<double> lval;
+    pack_particle_data(luid, lval);
+    const int num_local = static_cast<int>(luid.size());
+
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    const bool is_ioproc = amrex::ParallelDescriptor::IOProcessor();
+    std::vector<int> guid;
+    std::vector<double> gval;
+#ifdef AMREX_USE_MPI
+    {
+        const auto comm = amrex::ParallelDescriptor::Communicator();
+        const int nprocs = amrex::ParallelDescriptor::NProcs();
+        std::vector<int> pcounts(is_ioproc ? nprocs : 0);
+        MPI_Gather(
+            &num_local, 1, MPI_INT, pcounts.data(), 1, MPI_INT, ioproc, comm);
+
+        std::vector<int> uid_counts, uid_displs, val_counts, val_displs;
+        if (is_ioproc) {
+            uid_counts = pcounts;
+            uid_displs.resize(nprocs, 0);
+            val_counts.resize(nprocs);
+            val_displs.resize(nprocs, 0);
+            for (int ip = 0; ip < nprocs; ++ip) {
+                val_counts[ip] = pcounts[ip] * ncomp;
+                if (ip > 0) {
+                    uid_displs[ip] = uid_displs[ip - 1] + uid_counts[ip - 1];
+                    val_displs[ip] = val_displs[ip - 1] + val_counts[ip - 1];
+                }
+            }
+            const int num_global = uid_displs.back() + uid_counts.back();
+            guid.resize(num_global);
+            gval.resize(static_cast<size_t>(num_global) * ncomp);
+        }
+
+        MPI_Gatherv(
+            luid.data(), num_local, MPI_INT, guid.data(), uid_counts.data(),
+            uid_displs.data(), MPI_INT, ioproc, comm);
+        MPI_Gatherv(
+            lval.data(), num_local * ncomp, MPI_DOUBLE, gval.data(),
+            val_counts.data(), val_displs.data(), MPI_DOUBLE, ioproc, comm);
+    }
+#else
+    amrex::ignore_unused(ioproc, num_local);
+    guid = std::move(luid);
+    gval = std::move(lval);
+#endif
+
+    if (!is_ioproc) {
+        return;
+    }
+
+    const int ntotal = num_sampling_particles();
+    const int num_global = static_cast<int>(guid.size());
+    for (int ip = 0; ip < num_global; ++ip) {
+        const int uid = guid[ip];
+        for (int fid = 0; fid < ncomp; ++fid) {
+            buf[fid * ntotal + uid] = gval[ip * ncomp + fid];
+        }
+    }
+}
+
+std::pair<int, int> SamplingContainer::local_uid_range() const
+{
+    const long ntotal = num_sampling_particles();
+    const long nprocs = amrex::ParallelDescriptor::NProcs();
+    const long iproc = amrex::ParallelDescriptor::MyProc();
+    return {
+        static_cast<int>((ntotal * iproc) / nprocs),
+        static_cast<int>((ntotal * (iproc + 1)) / nprocs)};
+}
+
+void SamplingContainer::populate_local_buffer(std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::populate_local_buffer");
+
+    const int ncomp = NumRuntimeRealComps();
+    std::vector<int> luid;
+    std::vector<double> lval;
+    pack_particle_data(luid, lval);
+
+    const auto range = local_uid_range();
+    const int nrange = range.second - range.first;
+    std::vector<int> ruid;
+    std::vector<double> rval;
+#ifdef AMREX_USE_MPI
+    {
+        const auto comm = amrex::ParallelDescriptor::Communicator();
+        const long ntotal = num_sampling_particles();
+        const long nprocs = amrex::ParallelDescriptor::NProcs();
+        const int num_local = static_cast<int>(luid.size());
+
+        // Sort the local particles by the rank that writes them out
+        auto dest_proc = [=](const int uid) {
+            return static_cast<int>(
+                ((static_cast<long>(uid) + 1) * nprocs - 1) / ntotal);
+        };
+        std::vector<int> scounts(nprocs, 0);
+        for (const int uid : luid) {
+            ++scounts[dest_proc(uid)];
+        }
+        std::vector<int> sdispls(nprocs, 0);
+        for (int ip = 1; ip < nprocs; ++ip) {
+            sdispls[ip] = sdispls[ip - 1] + scounts[ip - 1];
+        }
+        std::vector<int> suid(num_local);
+        std::vector<double> sval(static_cast<size_t>(num_local) * ncomp);
+        {
+            std::vector<int> pos(sdispls);
+            for (int ip = 0; ip < num_local; ++ip) {
+                const int idx = pos[dest_proc(luid[ip])]++;
+                suid[idx] = luid[ip];
+                for (int fid = 0; fid < ncomp; ++fid) {
+                    sval[idx * ncomp + fid] = lval[ip * ncomp + fid];
+                }
+            }
+        }
+
+        std::vector<int> rcounts(nprocs);
+        MPI_Alltoall(
+            scounts.data(), 1, MPI_INT, rcounts.data(), 1, MPI_INT, comm);
+        std::vector<int> rdispls(nprocs, 0);
+        for (int ip = 1; ip < nprocs; ++ip) {
+            rdispls[ip] = rdispls[ip - 1] + rcounts[ip - 1];
+        }
+        const int num_recv = rdispls.back() + rcounts.back();
+        ruid.resize(num_recv);
+        rval.resize(static_cast<size_t>(num_recv) * ncomp);
+
+        MPI_Alltoallv(
+            suid.data(), scounts.data(), sdispls.data(), MPI_INT, ruid.data(),
+            rcounts.data(), rdispls.data(), MPI_INT, comm);
+
+        for (int ip = 0; ip < nprocs; ++ip) {
+            scounts[ip] *= ncomp;
+            sdispls[ip] *= ncomp;
+            rcounts[ip] *= ncomp;
+            rdispls[ip] *= ncomp;
+        }
+        MPI_Alltoallv(
+            sval.data(), scounts.data(), sdispls.data(), MPI_DOUBLE,
+            rval.data(), rcounts.data(), rdispls.data(), MPI_DOUBLE, comm);
+    }
+#else
+    ruid = std::move(luid);
+    rval = std::move(lval);
+#endif
+
+    buf.assign(static_cast<size_t>(nrange) * ncomp, 0.0);
+    const int num_recv = static_cast<int>(ruid.size());
+    for (int ip = 0; ip < num_recv; ++ip) {
+        const int lidx = ruid[ip] - range.first;
+        AMREX_ASSERT((lidx >= 0) && (lidx < nrange));
+        for (int fid = 0; fid < ncomp; ++fid) {
+            buf[fid * nrange + lidx] = rval[ip * ncomp + fid];
+        }
+    }
 }
 
 } // namespace amr_wind::sampling
@@ -1,4 +1,5 @@
 #include "amr-wind/utilities/tagging/CurvatureRefinement.H"
+#include "amr-wind/utilities/tagging/FusedRefinement.H"
 #include "amr-wind/CFDSim.H"
 
 #include "AMReX.H"
@@ -124,4 +125,10 @@ void CurvatureRefinement::operator()(
     }
 }
 
+bool CurvatureRefinement::fuse(FusedRefinement& fused)
+{
+    fused.add_curvature(*m_field, m_curv_value);
+    return true;
+}
+
 } // namespace amr_wind
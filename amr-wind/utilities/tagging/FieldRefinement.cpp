@@ -1,4 +1,5 @@
 #include "amr-wind/utilities/tagging/FieldRefinement.H"
+#include "amr-wind/utilities/tagging/FusedRefinement.H"
 #include "amr-wind/CFDSim.H"
 
 #include "AMReX.H"
@@ -113,4 +114,11 @@ void FieldRefinement::operator()(
     }
 }
 
+bool FieldRefinement::fuse(FusedRefinement& fused)
+{
+    fused.add_field_value(*m_field, m_field_error);
+    fused.add_field_jump(*m_field, m_grad_error);
+    return true;
+}
+
 } // namespace amr_wind
@@ -0,0 +1,358 @@
+#include "amr-wind/utilities/tagging/FusedRefinement.H"
+#include "amr-wind/CFDSim.H"
+
+#include "AMReX.H"
+
+#include <limits>
+
+namespace amr_wind {
+
+namespace {
+
+using Thresholds = FusedRefinement::Thresholds;
+
+//! Criteria that require ghost cells of the field
+constexpr int stencil_criteria =
+    FusedRefinement::Jump | FusedRefinement::GradientMag |
+    FusedRefinement::Curvature | FusedRefinement::VorticityMag |
+    FusedRefinement::QCriterion | FusedRefinement::QCriterionNondim;
+
+//! Criteria that require the gradient of a scalar field
+constexpr int gradient_criteria =
+    FusedRefinement::GradientMag | FusedRefinement::Curvature;
+
+//! Criteria that require the velocity gradient tensor
+constexpr int velocity_criteria = FusedRefinement::VorticityMag |
+                                  FusedRefinement::QCriterion |
+                                  FusedRefinement::QCriterionNondim;
+
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE bool tag_scalar(
+    int i,
+    int j,
+    int k,
+    amrex::Array4<amrex::Real const> const& farr,
+    Thresholds const& thr,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const& idx) noexcept
+{
+    const int active = thr.active;
+    if (((active & FusedRefinement::Value) != 0) &&
+        (farr(i, j, k) > thr.value)) {
+        return true;
+    }
+
+    if ((active & FusedRefinement::Jump) != 0) {
+        const amrex::Real axp = std::abs(farr(i + 1, j, k) - farr(i, j, k));
+        const amrex::Real ayp = std::abs(farr(i, j + 1, k) - farr(i, j, k));
+        const amrex::Real azp = std::abs(farr(i, j, k + 1) - farr(i, j, k));
+        const amrex::Real axm = std::abs(farr(i - 1, j, k) - farr(i, j, k));
+        const amrex::Real aym = std::abs(farr(i, j - 1, k) - farr(i, j, k));
+        const amrex::Real azm = std::abs(farr(i, j, k - 1) - farr(i, j, k));
+        const amrex::Real ax = amrex::max(axp, axm);
+        const amrex::Real ay = amrex::max(ayp, aym);
+        const amrex::Real az = amrex::max(azp, azm);
+        if (amrex::max(ax, ay, az) >= thr.jump) {
+            return true;
+        }
+    }
+
+    if ((active & gradient_criteria) == 0) {
+        return false;
+    }
+
+    // Gradient shared by gradient magnitude and curvature criteria
+    const auto phix = 0.5 * (farr(i + 1, j, k) - farr(i - 1, j, k)) * idx[0];
+    const auto phiy = 0.5 * (farr(i, j + 1, k) - farr(i, j - 1, k)) * idx[1];
+    const auto phiz = 0.5 * (farr(i, j, k + 1) - farr(i, j, k - 1)) * idx[2];
+
+    if ((active & FusedRefinement::GradientMag) != 0) {
+        const auto grad_mag = sqrt(phix * phix + phiy * phiy + phiz * phiz);
+        if (grad_mag > thr.gradmag) {
+            return true;
+        }
+    }
+
+    if ((active & FusedRefinement::Curvature) != 0) {
+        const auto phixx =
+            (farr(i + 1, j, k) - 2.0 * farr(i, j, k) + farr(i - 1, j, k)) *
+            idx[0] * idx[0];
+        const auto phiyy =
+            (farr(i, j + 1, k) - 2.0 * farr(i, j, k) + farr(i, j - 1, k)) *
+            idx[0] * idx[0];
+        const auto phizz =
+            (farr(i, j, k + 1) - 2.0 * farr(i, j, k) + farr(i, j, k - 1)) *
+            idx[0] * idx[0];
+
+        const auto phiz_ip1 =
+            0.5 * (farr(i + 1, j, k + 1) - farr(i + 1, j, k - 1)) * idx[2];
+        const auto phiz_im1 =
+            0.5 * (farr(i - 1, j, k + 1) - farr(i - 1, j, k - 1)) * idx[2];
+        const auto phiz_jp1 =
+            0.5 * (farr(i, j + 1, k + 1) - farr(i, j + 1, k - 1)) * idx[2];
+        const auto phiz_jm1 =
+            0.5 * (farr(i, j - 1, k + 1) - farr(i, j - 1, k - 1)) * idx[2];
+        const auto phiy_ip1 =
+            0.5 * (farr(i + 1, j + 1, k) - farr(i + 1, j - 1, k)) * idx[1];
+        const auto phiy_im1 =
+            0.5 * (farr(i - 1, j + 1, k) - farr(i - 1, j - 1, k)) * idx[1];
+        const auto phiyz = 0.5 * (phiz_jp1 - phiz_jm1) * idx[1];
+        const auto phixy = 0.5 * (phiy_ip1 - phiy_im1) * idx[0];
+        const auto phixz = 0.5 * (phiz_ip1 - phiz_im1) * idx[0];
+
+        const auto curv_mag =
+            std::abs(
+                phix * phix * phiyy - 2. * phix * phiy * phixy +
+                phiy * phiy * phixx + phix * phix * phizz -
+                2. * phix * phiz * phixz + phiz * phiz * phixx +
+                phiy * phiy * phizz - 2. * phiy * phiz * phiyz +
+                phiz * phiz * phiyy) /
+            std::pow(phix * phix + phiy * phiy + phiz * phiz, 1.5);
+        if (curv_mag > thr.curvature) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE bool tag_velocity(
+    int i,
+    int j,
+    int k,
+    amrex::Array4<amrex::Real const> const& vel,
+    Thresholds const& thr,
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> const& idx) noexcept
+{
+    const int active = thr.active;
+
+    // Velocity gradient shared by vorticity and Q-criterion
+    const auto ux = 0.5 * (vel(i + 1, j, k, 0) - vel(i - 1, j, k, 0)) * idx[0];
+    const auto vx = 0.5 * (vel(i + 1, j, k, 1) - vel(i - 1, j, k, 1)) * idx[0];
+    const auto wx = 0.5 * (vel(i + 1, j, k, 2) - vel(i - 1, j, k, 2)) * idx[0];
+
+    const auto uy = 0.5 * (vel(i, j + 1, k, 0) - vel(i, j - 1, k, 0)) * idx[1];
+    const auto vy = 0.5 * (vel(i, j + 1, k, 1) - vel(i, j - 1, k, 1)) * idx[1];
+    const auto wy = 0.5 * (vel(i, j + 1, k, 2) - vel(i, j - 1, k, 2)) * idx[1];
+
+    const auto uz = 0.5 * (vel(i, j, k + 1, 0) - vel(i, j, k - 1, 0)) * idx[2];
+    const auto vz = 0.5 * (vel(i, j, k + 1, 1) - vel(i, j, k - 1, 1)) * idx[2];
+    const auto wz = 0.5 * (vel(i, j, k + 1, 2) - vel(i, j, k - 1, 2)) * idx[2];
+
+    if ((active & FusedRefinement::VorticityMag) != 0) {
+        const auto vort = sqrt(
+            std::pow(uy - vx, 2) + std::pow(vz - wy, 2) +
+            std::pow(wx - uz, 2));
+        if (vort > thr.vorticity) {
+            return true;
+        }
+    }
+
+    if ((active &
+         (FusedRefinement::QCriterion | FusedRefinement::QCriterionNondim)) !=
+        0) {
+        const auto S2 = ux * ux + vy * vy + wz * wz +
+                        0.5 * std::pow(uy + vx, 2) +
+                        0.5 * std::pow(vz + wy, 2) + 0.5 * std::pow(wx + uz, 2);
+
+        const auto W2 = 0.5 * std::pow(uy - vx, 2) +
+                        0.5 * std::pow(vz - wy, 2) + 0.5 * std::pow(wx - uz, 2);
+
+        const auto qc = 0.5 * (W2 - S2);
+        const auto qc_nondim = 0.5 * (W2 / amrex::max(S2, 1.0e-12) - 1.0);
+
+        if (((active & FusedRefinement::QCriterionNondim) != 0) &&
+            (qc_nondim > thr.qcriterion_nondim)) {
+            return true;
+        }
+        if (((active & FusedRefinement::QCriterion) != 0) &&
+            (std::abs(qc) > thr.qcriterion)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace
+
+FusedRefinement::FusedRefinement(const CFDSim& sim) : m_sim(sim) {}
+
+FusedRefinement::FieldCriteria& FusedRefinement::field_criteria(Field& fld)
+{
+    for (auto& fc : m_fields) {
+        if (fc.field == &fld) {
+            return fc;
+        }
+    }
+
+    constexpr auto rmax = std::numeric_limits<amrex::Real>::max();
+    Thresholds thr;
+    thr.value = rmax;
+    thr.jump = rmax;
+    thr.gradmag = rmax;
+    thr.curvature = rmax;
+    thr.vorticity = rmax;
+    thr.qcriterion = rmax;
+    thr.qcriterion_nondim = rmax;
+    thr.active = 0;
+
+    FieldCriteria fc;
+    fc.field = &fld;
+    fc.thresholds.resize(m_sim.mesh().maxLevel() + 1, thr);
+    m_fields.push_back(fc);
+    return m_fields.back();
+}
+
+void FusedRefinement::add_criterion(
+    Field& fld, const Criterion crit, const amrex::Vector<amrex::Real>& values)
+{
+    constexpr auto rmax = std::numeric_limits<amrex::Real>::max();
+    auto& fc = field_criteria(fld);
+    const int nlevels = std::min(
+        static_cast<int>(values.size()),
+        static_cast<int>(fc.thresholds.size()));
+    for (int lev = 0; lev < nlevels; ++lev) {
+        if (values[lev] >= rmax) {
+            continue;
+        }
+
+        auto& thr = fc.thresholds[lev];
+        amrex::Real* val = nullptr;
+        switch (crit) {
+        case Value:
+            val = &thr.value;
+            break;
+        case Jump:
+            val = &thr.jump;
+            break;
+        case GradientMag:
+            val = &thr.gradmag;
+            break;
+        case Curvature:
+            val = &thr.curvature;
+            break;
+        case VorticityMag:
+            val = &thr.vorticity;
+            break;
+        case QCriterion:
+            val = &thr.qcriterion;
+            break;
+        case QCriterionNondim:
+            val = &thr.qcriterion_nondim;
+            break;
+        }
+        *val = amrex::min(*val, values[lev]);
+        thr.active |= crit;
+    }
+}
+
+void FusedRefinement::add_field_value(
+    Field& fld, const amrex::Vector<amrex::Real>& values)
+{
+    add_criterion(fld, Value, values);
+}
+
+void FusedRefinement::add_field_jump(
+    Field& fld, const amrex::Vector<amrex::Real>& values)
+{
+    add_criterion(fld, Jump, values);
+}
+
+void FusedRefinement::add_gradient_mag(
+    Field& fld, const amrex::Vector<amrex::Real>& values)
+{
+    add_criterion(fld, GradientMag, values);
+}
+
+void FusedRefinement::add_curvature(
+    Field& fld, const amrex::Vector<amrex::Real>& values)
+{
+    // The curvature threshold is limited by the mesh resolution of each
+    // level, so levels without a user value still tag above 1/dx
+    const int nlevels = m_sim.mesh().maxLevel() + 1;
+    amrex::Vector<amrex::Real> curv_values(values);
+    curv_values.resize(nlevels, std::numeric_limits<amrex::Real>::max());
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& idx = m_sim.mesh().Geom(lev).InvCellSizeArray();
+        curv_values[lev] =
+            std::min(curv_values[lev], std::cbrt(idx[0] * idx[1] * idx[2]));
+    }
+    add_criterion(fld, Curvature, curv_values);
+}
+
+void FusedRefinement::add_vorticity_mag(
+    Field& vel, const amrex::Vector<amrex::Real>& values)
+{
+    AMREX_ALWAYS_ASSERT(vel.num_comp() == AMREX_SPACEDIM);
+    add_criterion(vel, VorticityMag, values);
+}
+
+void FusedRefinement::add_qcriterion(
+    Field& vel, const amrex::Vector<amrex::Real>& values, const bool nondim)
+{
+    AMREX_ALWAYS_ASSERT(vel.num_comp() == AMREX_SPACEDIM);
+    add_criterion(vel, nondim ? QCriterionNondim : QCriterion, values);
+}
+
+void FusedRefinement::operator()(
+    int level, amrex::TagBoxArray& tags, amrex::Real time)
+{
+    BL_PROFILE("amr-wind::FusedRefinement");
+
+    // Collect the fields with active criteria on this level
+    amrex::Vector<const FieldCriteria*> active_fields;
+    for (const auto& fc : m_fields) {
+        const int active = fc.thresholds[level].active;
+        if (active == 0) {
+            continue;
+        }
+        if ((active & stencil_criteria) != 0) {
+            fc.field->fillpatch(level, time, (*fc.field)(level), 1);
+        }
+        active_fields.push_back(&fc);
+    }
+
+    if (active_fields.empty()) {
+        return;
+    }
+
+    const auto& idx = m_sim.repo().mesh().Geom(level).InvCellSizeArray();
+    const int num_active = static_cast<int>(active_fields.size());
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(tags, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto& tag = tags.array(mfi);
+
+        // Fields beyond max_fields are processed in additional kernels
+        for (int nstart = 0; nstart < num_active; nstart += max_fields) {
+            const int nfields = std::min(max_fields, num_active - nstart);
+            amrex::GpuArray<amrex::Array4<amrex::Real const>, max_fields> farrs;
+            amrex::GpuArray<Thresholds, max_fields> thresholds;
+            for (int n = 0; n < nfields; ++n) {
+                const auto* fc = active_fields[nstart + n];
+                farrs[n] = (*fc->field)(level).const_array(mfi);
+                thresholds[n] = fc->thresholds[level];
+            }
+
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    for (int n = 0; n < nfields; ++n) {
+                        const auto& thr = thresholds[n];
+                        const bool tagged =
+                            tag_scalar(i, j, k, farrs[n], thr, idx) ||
+                            (((thr.active & velocity_criteria) != 0) &&
+                             tag_velocity(i, j, k, farrs[n], thr, idx));
+                        if (tagged) {
+                            tag(i, j, k) = amrex::TagBox::SET;
+                            return;
+                        }
+                    }
+                });
+        }
+    }
+}
+
+} // namespace amr_wind
@@ -1,4 +1,5 @@
 #include "amr-wind/utilities/tagging/GradientMagRefinement.H"
+#include "amr-wind/utilities/tagging/FusedRefinement.H"
 #include "amr-wind/CFDSim.H"
 
 #include "AMReX.H"
@@ -82,4 +83,10 @@ void GradientMagRefinement::operator()(
     }
 }
 
+bool GradientMagRefinement::fuse(FusedRefinement& fused)
+{
+    fused.add_gradient_mag(*m_field, m_gradmag_value);
+    return true;
+}
+
 } // namespace amr_wind
@@ -1,4 +1,5 @@
 #include "amr-wind/utilities/tagging/QCriterionRefinement.H"
+#include "amr-wind/utilities/tagging/FusedRefinement.H"
 #include "amr-wind/CFDSim.H"
 
 #include "AMReX.H"
@@ -115,4 +116,10 @@ void QCriterionRefinement::operator()(
     }
 }
 
+bool QCriterionRefinement::fuse(FusedRefinement& fused)
+{
+    fused.add_qcriterion(*m_vel, m_qc_value, m_nondim);
+    return true;
+}
+
 } // namespace amr_wind
@@ -1,4 +1,5 @@
 #include "amr-wind/utilities/tagging/RefinementCriteria.H"
+#include "amr-wind/utilities/tagging/FusedRefinement.H"
 #include "amr-wind/CFDSim.H"
 
 #include "AMReX_ParmParse.H"
@@ -7,14 +8,22 @@ namespace amr_wind {
 
 RefineCriteriaManager::RefineCriteriaManager(CFDSim& sim) : m_sim(sim) {}
 
+RefineCriteriaManager::~RefineCriteriaManager() = default;
+
 void RefineCriteriaManager::initialize()
 {
     BL_PROFILE("amr-wind::RefineCriteriaManager::initialize");
     // Labels for different sampler types
     amrex::Vector<std::string> labels;
+    bool fused = true;
     {
         amrex::ParmParse pp("tagging");
         pp.queryarr("labels", labels);
+        pp.query("fused", fused);
+    }
+
+    if (fused) {
+        m_fused = std::make_unique<FusedRefinement>(m_sim);
     }
 
     for (const auto& lbl : labels) {
@@ -25,14 +34,25 @@ void RefineCriteriaManager::initialize()
 
         auto obj = RefinementCriteria::create(stype, m_sim);
         obj->initialize(key);
+        if (!m_fused || !obj->fuse(*m_fused)) {
+            m_unfused.push_back(obj.get());
+        }
         m_refiners.emplace_back(std::move(obj));
     }
+
+    if (m_fused && m_fused->empty()) {
+        m_fused.reset();
+    }
 }
 
 void RefineCriteriaManager::tag_cells(
     int lev, amrex::TagBoxArray& tags, amrex::Real time, int ngrow)
 {
-    for (const auto& rc : m_refiners) {
+    BL_PROFILE("amr-wind::RefineCriteriaManager::tag_cells");
+    if (m_fused) {
+        (*m_fused)(lev, tags, time);
+    }
+    for (auto* rc : m_unfused) {
         (*rc)(lev, tags, time, ngrow);
     }
 }
@@ -1,4 +1,5 @@
 #include "amr-wind/utilities/tagging/VorticityMagRefinement.H"
+#include "amr-wind/utilities/tagging/FusedRefinement.H"
 #include "amr-wind/CFDSim.H"
 
 #include "AMReX.H"
@@ -96,4 +97,10 @@ void VorticityMagRefinement::operator()(
     }
 }
 
+bool VorticityMagRefinement::fuse(FusedRefinement& fused)
+{
+    fused.add_vorticity_mag(*m_vel, m_vort_value);
+    return true;
+}
+
 } // namespace amr_wind
@@ -73,7 +73,6 @@ void ABL::initialize_fields(int level, const amrex::Geometry& geom)
         temp.setVal(0.0);
     }
 
-    bool interp_fine_levels = false;
     for (amrex::MFIter mfi(density); mfi.isValid(); ++mfi) {
         const auto& vbx = mfi.validbox();
 
@@ -81,12 +80,12 @@ void ABL::initialize_fields(int level, const amrex::Geometry& geom)
         (*m_field_init)(
             vbx, geom, velocity.array(mfi), density.array(mfi),
             temp.array(mfi));
+    }
 
-        // Overwrite velocities from file
-        if (m_file_input) {
-            interp_fine_levels =
-                (*m_field_init_file)(vbx, geom, velocity.array(mfi), level);
-        }
+    // Overwrite velocities from file
+    bool interp_fine_levels = false;
+    if (m_file_input) {
+        interp_fine_levels = (*m_field_init_file)(geom, velocity, level);
     }
 
     if (interp_fine_levels) {
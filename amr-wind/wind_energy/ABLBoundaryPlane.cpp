@@ -1,11 +1,18 @@
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/wind_energy/ABLBoundaryPlane.H"
 #include "amr-wind/wind_energy/ABLFillInflow.H"
+#include "amr-wind/utilities/PerfTimers.H"
 #include "AMReX_Gpu.H"
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 #include <AMReX_PlotFileUtil.H>
 
+#include <AMReX_VisMF.H>
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
 namespace amr_wind {
 
 namespace {
@@ -50,6 +57,83 @@ AMREX_FORCE_INLINE amrex::IntVect offset(const int face_dir, const int normal)
     return offset;
 }
 
+/** Quantization step for lossy compression with a maximum error `tol`
+ *
+ *  The step is the largest power of two that does not exceed twice the
+ *  tolerance, so that rounding to a multiple of it bounds the error by the
+ *  tolerance. Because the step is a power of two, the rounded values have
+ *  trailing zero bits in their single precision mantissa, which the deflate
+ *  filter compresses well. Returns zero (no rounding) for a zero tolerance.
+ */
+amrex::Real quantization_step(const amrex::Real tol)
+{
+    if (tol <= 0.0) {
+        return 0.0;
+    }
+    return std::exp2(std::floor(std::log2(2.0 * tol)));
+}
+
+//! Round a value to the nearest multiple of `quantum` (if positive)
+AMREX_FORCE_INLINE amrex::Real
+quantize(const amrex::Real val, const amrex::Real quantum)
+{
+    return (quantum > 0.0) ? std::round(val / quantum) * quantum : val;
+}
+
+/** Read the FABs of a boundary face file owned by this rank and discard them
+ *
+ *  This brings the boundary data of an upcoming time into the file system
+ *  cache so that the collective read later on does not stall on the disk. It
+ *  only performs local file I/O and is safe to run on a background thread.
+ *
+ *  \param facename Name of the FabSet file of the boundary face
+ *  \param owned Indices of the boxes that will be read by this rank
+ *  \param nboxes Expected number of boxes in the file
+ */
+void read_ahead(
+    const std::string& facename,
+    const amrex::Vector<int>& owned,
+    const int nboxes)
+{
+    std::ifstream hfile(facename + "_H");
+    if (!hfile.good()) {
+        return;
+    }
+    amrex::VisMF::Header hdr;
+    hfile >> hdr;
+
+    // Files that are not aligned with the current mesh are redistributed on
+    // read and the ownership cannot be predicted here
+    if (static_cast<int>(hdr.m_ba.size()) != nboxes) {
+        return;
+    }
+
+    const std::string dirname = amrex::VisMF::DirName(facename);
+    std::vector<char> buffer;
+    for (const int idx : owned) {
+        const auto& fod = hdr.m_fod[idx];
+        std::ifstream ifh(
+            dirname + fod.m_name, std::ios::in | std::ios::binary);
+        ifh.seekg(fod.m_head);
+
+        // The FAB header gives the precision the data was written with
+        std::string tag;
+        amrex::RealDescriptor rd;
+        amrex::Box bx;
+        int ncomp = 0;
+        ifh >> tag >> rd >> bx >> ncomp;
+        ifh.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        if ((tag != "FAB") || !ifh.good()) {
+            continue;
+        }
+
+        const auto nbytes = static_cast<std::streamsize>(
+            bx.numPts() * ncomp * rd.numBytes());
+        buffer.resize(nbytes);
+        ifh.read(buffer.data(), nbytes);
+    }
+}
+
 #ifdef AMR_WIND_USE_NETCDF
 AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE int
 plane_idx(const int i, const int j, const int k, const int perp, const int lo)
@@ -92,28 +176,38 @@ void InletData::define_level_data(
     m_data_interp[ori]->push_back(amrex::FArrayBox(bx, static_cast<int>(nc)));
 }
 
+bool InletData::update_interval(
+    const int idx, const amrex::Vector<amrex::Real>& times)
+{
+    // The plane at n + 1 of the previous interval is the new plane at n
+    const bool recycle = (idx == m_idx_np1);
+    if (recycle) {
+        std::swap(m_data_n, m_data_np1);
+    }
+
+    m_idx_np1 = idx + 1;
+    m_tn = times[idx];
+    m_tnp1 = times[m_idx_np1];
+    return !recycle;
+}
+
 #ifdef AMR_WIND_USE_NETCDF
 void InletData::read_data(
     ncutils::NCGroup& grp,
     const amrex::Orientation ori,
     const int lev,
     const Field* fld,
-    const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const int idx,
+    const bool at_np1)
 {
     const size_t nc = fld->num_comp();
     const int nstart = m_components[fld->id()];
 
-    const int idx = closest_index(times, time);
-    const int idxp1 = idx + 1;
-    m_tn = times[idx];
-    m_tnp1 = times[idxp1];
-    AMREX_ALWAYS_ASSERT(((m_tn <= time) && (time <= m_tnp1)));
-
     const int normal = ori.coordDir();
     const amrex::GpuArray<int, 2> perp = perpendicular_idx(normal);
 
-    const auto& bx = (*m_data_n[ori])[lev].box();
+    auto& dat = plane_data(ori, at_np1)[lev];
+    const auto& bx = dat.box();
     const auto& lo = bx.loVect();
     const size_t n0 = bx.length(perp[0]);
     const size_t n1 = bx.length(perp[1]);
@@ -125,67 +219,46 @@ void InletData::read_data(
     amrex::Vector<amrex::Real> buffer(n0 * n1 * nc);
     grp.var(fld->name()).get(buffer.data(), start, count);
 
-    const auto& datn = ((*m_data_n[ori])[lev]).array();
+    const auto& dat_arr = dat.array();
     auto d_buffer = buffer.dataPtr();
     amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
         const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
         const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-        datn(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
-    });
-
-    start[0] = static_cast<size_t>(idxp1);
-    grp.var(fld->name()).get(buffer.data(), start, count);
-
-    const auto& datnp1 = ((*m_data_np1[ori])[lev]).array();
-    amrex::LoopOnCpu(bx, nc, [=](int i, int j, int k, int n) noexcept {
-        const int i0 = plane_idx(i, j, k, perp[0], lo[perp[0]]);
-        const int i1 = plane_idx(i, j, k, perp[1], lo[perp[1]]);
-        datnp1(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
+        dat_arr(i, j, k, n + nstart) = d_buffer[((i0 * n1) + i1) * nc + n];
     });
 
-    ((*m_data_n[ori])[lev]).prefetchToDevice();
-    ((*m_data_np1[ori])[lev]).prefetchToDevice();
+    dat.prefetchToDevice();
 }
 
 #endif
 
 void InletData::read_data_native(
-    const amrex::OrientationIter oit,
-    amrex::BndryRegister& bndry_n,
-    amrex::BndryRegister& bndry_np1,
+    const amrex::Orientation ori,
+    const amrex::MultiFab& bndry_face,
     const int lev,
     const Field* fld,
-    const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const bool at_np1)
 {
     const size_t nc = fld->num_comp();
     const int nstart =
         static_cast<int>(m_components[static_cast<int>(fld->id())]);
 
-    const int idx = closest_index(times, time);
-    const int idxp1 = idx + 1;
-
-    m_tn = times[idx];
-    m_tnp1 = times[idxp1];
-
-    auto ori = oit();
-
-    AMREX_ALWAYS_ASSERT(((m_tn <= time) && (time <= m_tnp1)));
-    AMREX_ALWAYS_ASSERT(fld->num_comp() == bndry_n[ori].nComp());
-    AMREX_ASSERT(bndry_n[ori].boxArray() == bndry_np1[ori].boxArray());
+    AMREX_ALWAYS_ASSERT(fld->num_comp() == bndry_face.nComp());
 
     const int normal = ori.coordDir();
-    const auto& bbx = (*m_data_n[ori])[lev].box();
+    auto& dat = plane_data(ori, at_np1)[lev];
+    const auto& bbx = dat.box();
     const amrex::IntVect v_offset = offset(ori.faceDir(), normal);
 
     amrex::MultiFab bndry(
-        bndry_n[ori].boxArray(), bndry_n[ori].DistributionMap(),
-        bndry_n[ori].nComp(), 0, amrex::MFInfo());
+        bndry_face.boxArray(), bndry_face.DistributionMap(),
+        bndry_face.nComp(), 0, amrex::MFInfo());
+    bndry.setVal(0.0);
 
     for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
 
         const auto& vbx = mfi.validbox();
-        const auto& bndry_n_arr = bndry_n[ori].array(mfi);
+        const auto& bndry_face_arr = bndry_face.const_array(mfi);
         const auto& bndry_arr = bndry.array(mfi);
 
         const auto& bx = bbx & vbx;
@@ -196,36 +269,14 @@ void InletData::read_data_native(
         amrex::ParallelFor(
             bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
                 bndry_arr(i, j, k, n) =
-                    0.5 *
-                    (bndry_n_arr(i, j, k, n) +
-                     bndry_n_arr(
-                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
+                    0.5 * (bndry_face_arr(i, j, k, n) +
+                           bndry_face_arr(
+                               i + v_offset[0], j + v_offset[1],
+                               k + v_offset[2], n));
             });
     }
 
-    bndry.copyTo((*m_data_n[ori])[lev], 0, nstart, static_cast<int>(nc));
-
-    for (amrex::MFIter mfi(bndry); mfi.isValid(); ++mfi) {
-        const auto& vbx = mfi.validbox();
-        const auto& bndry_np1_arr = bndry_np1[ori].array(mfi);
-        const auto& bndry_arr = bndry.array(mfi);
-
-        const auto& bx = bbx & vbx;
-        if (bx.isEmpty()) {
-            continue;
-        }
-
-        amrex::ParallelFor(
-            bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                bndry_arr(i, j, k, n) =
-                    0.5 *
-                    (bndry_np1_arr(i, j, k, n) +
-                     bndry_np1_arr(
-                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
-            });
-    }
-
-    bndry.copyTo((*m_data_np1[ori])[lev], 0, nstart, static_cast<int>(nc));
+    bndry.copyTo(dat, 0, nstart, static_cast<int>(nc));
 }
 
 void InletData::interpolate(const amrex::Real time)
@@ -256,7 +307,10 @@ bool InletData::is_populated(amrex::Orientation ori) const
 }
 
 ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
-    : m_time(sim.time()), m_repo(sim.repo()), m_mesh(sim.mesh())
+    : m_time(sim.time())
+    , m_repo(sim.repo())
+    , m_mesh(sim.mesh())
+    , m_perf_timers(sim.perf_timers())
 {
     amrex::ParmParse pp("ABL");
     int pp_io_mode = -1;
@@ -282,6 +336,17 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
     pp.queryarr("bndry_var_names", m_var_names);
     pp.get("bndry_file", m_filename);
     pp.query("bndry_output_format", m_out_fmt);
+    pp.query("bndry_prefetch", m_prefetch);
+    pp.query("bndry_compression", m_compression);
+    pp.query("bndry_compression_level", m_compression_level);
+    pp.query("bndry_compression_tolerance", m_compression_tol);
+
+    if (!(m_compression == "none" || m_compression == "lossless" ||
+          m_compression == "lossy")) {
+        amrex::Abort(
+            "ABLBoundaryPlane: invalid bndry_compression = " + m_compression +
+            ". Valid options are: none, lossless, lossy");
+    }
 
 #ifndef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
@@ -300,6 +365,13 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
         m_out_fmt = "native";
     }
 
+    if (m_out_fmt == "native" && m_compression == "lossless") {
+        amrex::Print() << "Warning: lossless boundary compression requires "
+                          "netcdf output format, disabling compression"
+                       << std::endl;
+        m_compression = "none";
+    }
+
     // only used for native format
     m_time_file = m_filename + "/time.dat";
 }
@@ -415,22 +487,36 @@ void ABLBoundaryPlane::write_header()
                 lev_grp.def_var("hi", NC_DOUBLE, {"pdim"});
                 lev_grp.def_var("dx", NC_DOUBLE, {"pdim"});
 
+                // Lossy compression stores single precision data
+                const nc_type dtype =
+                    (m_compression == "lossy") ? NC_FLOAT : NC_DOUBLE;
                 const amrex::Vector<std::string> dirs{"nx", "ny", "nz"};
                 for (auto* fld : m_fields) {
                     const std::string name = fld->name();
                     if (fld->num_comp() == 1) {
                         lev_grp.def_var(
-                            name, NC_DOUBLE,
-                            {"nt", dirs[perp[0]], dirs[perp[1]]});
+                            name, dtype, {"nt", dirs[perp[0]], dirs[perp[1]]});
                     } else if (fld->num_comp() == AMREX_SPACEDIM) {
                         lev_grp.def_var(
-                            name, NC_DOUBLE,
+                            name, dtype,
                             {"nt", dirs[perp[0]], dirs[perp[1]], "vdim"});
+                    } else {
+                        continue;
+                    }
+                    if (m_compression != "none") {
+                        lev_grp.var(name).def_deflate(
+                            true, m_compression_level);
                     }
                 }
             }
         }
         ncf.put_attr("title", m_title);
+        ncf.put_attr("compression", m_compression);
+        if (m_compression == "lossy") {
+            ncf.put_attr(
+                "compression_tolerance",
+                std::vector<double>{static_cast<double>(m_compression_tol)});
+        }
         ncf.exit_def_mode();
 
         // Populate coordinates
@@ -482,6 +568,7 @@ void ABLBoundaryPlane::write_header()
 void ABLBoundaryPlane::write_file()
 {
     BL_PROFILE("amr-wind::ABLBoundaryPlane::write_file");
+    auto timer = m_perf_timers.scope("boundary_io");
     const amrex::Real time = m_time.new_time();
     const int t_step = m_time.time_index();
 
@@ -551,24 +638,19 @@ void ABLBoundaryPlane::write_file()
         // for now only output level 0
         const int lev = 0;
 
+        // Lossy compression stores single precision data. The native format
+        // has no entropy coder, so the data is not quantized in this case.
+        const auto fab_format = amrex::FArrayBox::getFormat();
+        if (m_compression == "lossy") {
+            amrex::FArrayBox::setFormat(amrex::FABio::FAB_NATIVE_32);
+        }
+
         for (auto* fld : m_fields) {
 
             auto& field = *fld;
 
             const auto& geom = field.repo().mesh().Geom();
 
-            // note: by using the entire domain box we end up using 1 processor
-            // to hold all boundaries
-            amrex::Box domain = geom[lev].Domain();
-            amrex::BoxArray ba(domain);
-            amrex::DistributionMapping dm{ba};
-
-            amrex::BndryRegister bndry(
-                ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp());
-
-            bndry.copyFrom(
-                field(lev), 0, 0, 0, field.num_comp(), geom[lev].periodicity());
-
             std::string filename = amrex::MultiFabFileFullPrefix(
                 lev, chkname, level_prefix, field.name());
 
@@ -582,11 +664,20 @@ void ABLBoundaryPlane::write_file()
                     continue;
                 }
 
+                // Each rank writes the faces of the boxes it owns
+                amrex::BndryRegister bndry;
+                define_bndry_register(ori, field.num_comp(), bndry);
+                bndry[ori].copyFrom(
+                    field(lev), 0, 0, 0, field.num_comp(),
+                    geom[lev].periodicity());
+
                 std::string facename =
                     amrex::Concatenate(filename + '_', ori, 1);
                 bndry[ori].write(facename);
             }
         }
+
+        amrex::FArrayBox::setFormat(fab_format);
     }
 }
 
@@ -752,6 +843,7 @@ void ABLBoundaryPlane::read_header()
 void ABLBoundaryPlane::read_file()
 {
     BL_PROFILE("amr-wind::ABLBoundaryPlane::read_file");
+    auto timer = m_perf_timers.scope("boundary_io");
     if (m_io_mode != io_mode::input) {
         return;
     }
@@ -766,6 +858,13 @@ void ABLBoundaryPlane::read_file()
         return;
     }
 
+    const int index = closest_index(m_in_times, time);
+    AMREX_ALWAYS_ASSERT(
+        (m_in_times[index] <= time) && (time <= m_in_times[index + 1]));
+
+    // Only read the planes that are not already in memory
+    const bool read_n = m_in_data.update_interval(index, m_in_times);
+
 #ifdef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
 
@@ -782,7 +881,10 @@ void ABLBoundaryPlane::read_file()
             for (auto* fld : m_fields) {
                 for (int lev = 0; lev < nlevels; ++lev) {
                     auto grp = ncf.group(plane).group(level_name(lev));
-                    m_in_data.read_data(grp, ori, lev, fld, time, m_in_times);
+                    if (read_n) {
+                        m_in_data.read_data(grp, ori, lev, fld, index, false);
+                    }
+                    m_in_data.read_data(grp, ori, lev, fld, index + 1, true);
                 }
             }
         }
@@ -791,67 +893,155 @@ void ABLBoundaryPlane::read_file()
 #endif
 
     if (m_out_fmt == "native") {
+        if (read_n) {
+            read_native(index, false);
+        }
+        read_native(index + 1, true);
+        prefetch_native(index + 2);
+    }
 
-        const int index = closest_index(m_in_times, time);
-        const int t_step1 = m_in_timesteps[index];
-        const int t_step2 = m_in_timesteps[index + 1];
+    m_in_data.interpolate(time);
+}
 
-        AMREX_ALWAYS_ASSERT(
-            (m_in_times[index] <= time) && (time <= m_in_times[index + 1]));
+void ABLBoundaryPlane::define_bndry_register(
+    const amrex::Orientation ori,
+    const int ncomp,
+    amrex::BndryRegister& bndry) const
+{
+    const int lev = 0;
+    const auto& domain = m_mesh.Geom(lev).Domain();
+    const auto& ba = m_mesh.boxArray(lev);
+    const auto& dm = m_mesh.DistributionMap(lev);
+    const int normal = ori.coordDir();
 
-        const std::string chkname1 =
-            m_filename + amrex::Concatenate("/bndry_output", t_step1);
-        const std::string chkname2 =
-            m_filename + amrex::Concatenate("/bndry_output", t_step2);
+    amrex::BoxList bl;
+    amrex::Vector<int> pmap;
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        const auto& bx = ba[i];
+        const bool on_boundary =
+            ori.isLow() ? (bx.smallEnd(normal) == domain.smallEnd(normal))
+                        : (bx.bigEnd(normal) == domain.bigEnd(normal));
+        if (on_boundary) {
+            bl.push_back(bx);
+            pmap.push_back(dm[i]);
+        }
+    }
 
-        const std::string level_prefix = "Level_";
+    bndry.setBoxes(amrex::BoxArray(std::move(bl)));
+    bndry.define(
+        ori, amrex::IndexType::TheCellType(), m_in_rad, m_out_rad,
+        m_extent_rad, ncomp, amrex::DistributionMapping(std::move(pmap)));
+}
 
-        const int lev = 0;
-        for (auto* fld : m_fields) {
+std::string ABLBoundaryPlane::native_face_name(
+    const int t_idx, const Field& field, const amrex::Orientation ori) const
+{
+    const int lev = 0;
+    const std::string chkname =
+        m_filename + amrex::Concatenate("/bndry_output", m_in_timesteps[t_idx]);
+    const std::string filename =
+        amrex::MultiFabFileFullPrefix(lev, chkname, "Level_", field.name());
+    return amrex::Concatenate(filename + '_', ori, 1);
+}
 
-            auto& field = *fld;
-            const auto& geom = field.repo().mesh().Geom();
+void ABLBoundaryPlane::read_native(const int t_idx, const bool at_np1)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::read_native");
 
-            amrex::Box domain = geom[lev].Domain();
-            amrex::BoxArray ba(domain);
-            amrex::DistributionMapping dm{ba};
+    // Make sure the background thread is no longer reading these files
+    wait_for_prefetch();
 
-            amrex::BndryRegister bndry1(
-                ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp());
-            amrex::BndryRegister bndry2(
-                ba, dm, m_in_rad, m_out_rad, m_extent_rad, field.num_comp());
+    const int lev = 0;
+    for (auto* fld : m_fields) {
+        auto& field = *fld;
+        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
 
-            bndry1.setVal(1.0e13);
-            bndry2.setVal(1.0e13);
+            if ((!m_in_data.is_populated(ori)) ||
+                (field.bc_type()[ori] != BC::mass_inflow)) {
+                continue;
+            }
 
-            std::string filename1 = amrex::MultiFabFileFullPrefix(
-                lev, chkname1, level_prefix, field.name());
-            std::string filename2 = amrex::MultiFabFileFullPrefix(
-                lev, chkname2, level_prefix, field.name());
+            const auto facename = native_face_name(t_idx, field, ori);
+
+            // When the file was written with the same level 0 grids, each
+            // rank reads the boundary patches of the boxes it owns. Files
+            // with a different decomposition (e.g., from a precursor with a
+            // different max_grid_size) use the default mapping of VisMF.
+            amrex::BndryRegister bndry;
+            define_bndry_register(ori, field.num_comp(), bndry);
+            const amrex::VisMF vismf(facename);
+            amrex::MultiFab bndry_face;
+            if (amrex::match(vismf.boxArray(), bndry[ori].boxArray())) {
+                bndry_face.define(
+                    vismf.boxArray(), bndry[ori].DistributionMap(),
+                    vismf.nComp(), 0);
+            }
+            amrex::VisMF::Read(bndry_face, facename);
 
-            for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
-                auto ori = oit();
+            m_in_data.read_data_native(ori, bndry_face, lev, fld, at_np1);
+        }
+    }
+}
 
-                if ((!m_in_data.is_populated(ori)) ||
-                    (field.bc_type()[ori] != BC::mass_inflow)) {
-                    continue;
-                }
+void ABLBoundaryPlane::prefetch_native(const int t_idx)
+{
+    if (!m_prefetch || (t_idx >= static_cast<int>(m_in_timesteps.size()))) {
+        return;
+    }
 
-                std::string facename1 =
-                    amrex::Concatenate(filename1 + '_', ori, 1);
-                std::string facename2 =
-                    amrex::Concatenate(filename2 + '_', ori, 1);
+    struct FaceFile
+    {
+        std::string name;
+        amrex::Vector<int> owned;
+        int nboxes;
+    };
 
-                bndry1[ori].read(facename1);
-                bndry2[ori].read(facename2);
+    // Determine the boxes that this rank will read on the main thread
+    const int myproc = amrex::ParallelDescriptor::MyProc();
+    std::vector<FaceFile> files;
+    for (auto* fld : m_fields) {
+        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
+            if ((!m_in_data.is_populated(ori)) ||
+                (fld->bc_type()[ori] != BC::mass_inflow)) {
+                continue;
+            }
 
-                m_in_data.read_data_native(
-                    oit, bndry1, bndry2, lev, fld, time, m_in_times);
+            amrex::BndryRegister bndry;
+            define_bndry_register(ori, fld->num_comp(), bndry);
+            const auto& dm = bndry[ori].DistributionMap();
+            FaceFile face{
+                native_face_name(t_idx, *fld, ori), {},
+                static_cast<int>(bndry[ori].boxArray().size())};
+            for (int i = 0; i < face.nboxes; ++i) {
+                if (dm[i] == myproc) {
+                    face.owned.push_back(i);
+                }
+            }
+            if (!face.owned.empty()) {
+                files.push_back(std::move(face));
             }
         }
     }
 
-    m_in_data.interpolate(time);
+    if (files.empty()) {
+        return;
+    }
+
+    m_prefetch_future =
+        std::async(std::launch::async, [files = std::move(files)]() {
+            for (const auto& face : files) {
+                read_ahead(face.name, face.owned, face.nboxes);
+            }
+        });
+}
+
+void ABLBoundaryPlane::wait_for_prefetch()
+{
+    if (m_prefetch_future.valid()) {
+        m_prefetch_future.get();
+    }
 }
 
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
@@ -1024,6 +1214,15 @@ void ABLBoundaryPlane::write_data(
         }
     }
 
+    if (m_compression == "lossy") {
+        const amrex::Real quantum = quantization_step(m_compression_tol);
+        for (auto& buffer : buffers) {
+            for (auto& val : buffer.data) {
+                val = quantize(val, quantum);
+            }
+        }
+    }
+
     for (const auto& buffer : buffers) {
         grp.var(name).put(buffer.data.dataPtr(), buffer.start, buffer.count);
     }
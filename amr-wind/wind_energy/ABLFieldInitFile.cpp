@@ -4,10 +4,32 @@
 #include "amr-wind/utilities/trig_ops.H"
 #include "AMReX_Gpu.H"
 #include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_ParallelReduce.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
 namespace amr_wind {
 
+namespace {
+
+/** Index of the input plane bounding a mesh cell in one direction
+ *
+ *  The cell center is mapped onto the continuous index space of the input
+ *  grid, assuming both grids span the same physical extent. The upper bound
+ *  includes the right neighbor used for linear interpolation. The result is
+ *  clipped to the input grid.
+ */
+int src_index(const int idx, const int nmesh, const int nsrc, const bool upper)
+{
+    const amrex::Real xi =
+        (idx + 0.5) * static_cast<amrex::Real>(nsrc) / nmesh - 0.5;
+    const int il = static_cast<int>(std::floor(xi));
+    const int ii = (upper && (xi > il)) ? il + 1 : il;
+    return amrex::max(0, amrex::min(ii, nsrc - 1));
+}
+
+} // namespace
+
 ABLFieldInitFile::ABLFieldInitFile()
 {
 #ifndef AMR_WIND_USE_NETCDF
@@ -19,74 +41,118 @@ ABLFieldInitFile::ABLFieldInitFile()
     amrex::ParmParse pp_abl("ABL");
     // Get netcdf input file name
     pp_abl.get("initial_condition_input_file", m_ic_input);
+    pp_abl.query("initial_condition_parallel_read", m_parallel_read);
 }
 
 bool ABLFieldInitFile::operator()(
-    const amrex::Box& vbx,
     const amrex::Geometry& geom,
-    const amrex::Array4<amrex::Real>& velocity,
+    amrex::MultiFab& velocity,
     const int lev) const
 {
+    BL_PROFILE("amr-wind::ABLFieldInitFile");
 #ifdef AMR_WIND_USE_NETCDF
-    // Load the netcdf file with data if specified in the inputs
-    if (lev == 0) {
-
-        // Open the netcdf input file
-        // This file should have the same dimensions as the simulation
-        auto ncf = ncutils::NCFile::open(m_ic_input, NC_NOWRITE);
-
-        // Ensure that the input dimensions match the coarsest grid size
-        const auto& domain = geom.Domain();
-
-        // The indices that determine the start and end points of the i, j, k
-        // arrays. The max and min are there to ensure that the points form
-        // ghost cells are not used
-        auto i0 = amrex::max(vbx.smallEnd(0), domain.smallEnd(0));
-        auto i1 = amrex::min(vbx.bigEnd(0), domain.bigEnd(0));
-
-        auto j0 = amrex::max(vbx.smallEnd(1), domain.smallEnd(1));
-        auto j1 = amrex::min(vbx.bigEnd(1), domain.bigEnd(1));
-
-        auto k0 = amrex::max(vbx.smallEnd(2), domain.smallEnd(2));
-        auto k1 = amrex::min(vbx.bigEnd(2), domain.bigEnd(2));
-
-        // The x, y and z velocity components (u, v, w)
-        auto uvel = ncf.var("uvel");
-        auto vvel = ncf.var("vvel");
-        auto wvel = ncf.var("wvel");
-
-        // Loop through all points in the domain and set velocities to values
-        // from the input file
-        // start is the first index from where to read data
-        amrex::Vector<size_t> start{
-            {static_cast<size_t>(i0), static_cast<size_t>(j0),
-             static_cast<size_t>(k0)}};
-        // count is the total number of elements to read in each direction
-        amrex::Vector<size_t> count{
-            {static_cast<size_t>(i1 - i0 + 1), static_cast<size_t>(j1 - j0 + 1),
-             static_cast<size_t>(k1 - k0 + 1)}};
-
-        // Working vector to read data onto host
-        amrex::Vector<double> tmp;
-        int dlen = count[0] * count[1] * count[2];
-        tmp.resize(dlen);
-        // Vector to store the 3d data into a single array and set size
-        amrex::Gpu::DeviceVector<amrex::Real> uvel_d(dlen, 0.0);
-        amrex::Gpu::DeviceVector<amrex::Real> vvel_d(dlen, 0.0);
-        amrex::Gpu::DeviceVector<amrex::Real> wvel_d(dlen, 0.0);
+    // Skip finer levels and interpolate data from already loaded coarse levels
+    if (lev > 0) {
+        return true;
+    }
+
+    // Open the file once per rank. With the parallel read all ranks share a
+    // single MPI-IO handle and every hyperslab read is a collective call, so
+    // that the MPI-IO layer can aggregate the requests of all ranks.
+    const auto comm = amrex::ParallelContext::CommunicatorSub();
+    auto ncf = m_parallel_read
+                   ? ncutils::NCFile::open_par(
+                         m_ic_input, NC_NOWRITE | NC_MPIIO, comm,
+                         MPI_INFO_NULL)
+                   : ncutils::NCFile::open(m_ic_input, NC_NOWRITE);
+
+    // The x, y and z velocity components (u, v, w)
+    auto uvel = ncf.var("uvel");
+    auto vvel = ncf.var("vvel");
+    auto wvel = ncf.var("wvel");
+    if (m_parallel_read) {
+        uvel.par_access(NC_COLLECTIVE);
+        vvel.par_access(NC_COLLECTIVE);
+        wvel.par_access(NC_COLLECTIVE);
+    }
+
+    const auto& domain = geom.Domain();
+    const auto dlo = amrex::lbound(domain);
+    const auto nmesh = domain.length3d();
+    const auto shape = uvel.shape();
+    AMREX_ALWAYS_ASSERT(shape.size() == AMREX_SPACEDIM);
+    const amrex::GpuArray<int, AMREX_SPACEDIM> nsrc{
+        static_cast<int>(shape[0]), static_cast<int>(shape[1]),
+        static_cast<int>(shape[2])};
+    const bool interp =
+        (nsrc[0] != nmesh[0]) || (nsrc[1] != nmesh[1]) || (nsrc[2] != nmesh[2]);
+    if (interp) {
+        amrex::Print() << "ABLFieldInitFile: interpolating initial condition "
+                       << "from " << nsrc[0] << " x " << nsrc[1] << " x "
+                       << nsrc[2] << " to " << nmesh[0] << " x " << nmesh[1]
+                       << " x " << nmesh[2] << std::endl;
+    }
+
+    // Collective reads must be issued the same number of times on every rank,
+    // ranks with fewer boxes issue empty reads for the remaining calls
+    int nreads = velocity.local_size();
+    if (m_parallel_read) {
+        amrex::ParallelAllReduce::Max(nreads, comm);
+    }
+
+    // Working vectors to read data onto host
+    amrex::Vector<double> uvel_h, vvel_h, wvel_h;
+    amrex::Gpu::DeviceVector<double> uvel_d, vvel_d, wvel_d;
+
+    amrex::MFIter mfi(velocity);
+    for (int ir = 0; ir < nreads; ++ir) {
+        if (!mfi.isValid()) {
+            double dummy = 0.0;
+            const std::vector<size_t> zero{0, 0, 0};
+            uvel.get(&dummy, zero, zero);
+            vvel.get(&dummy, zero, zero);
+            wvel.get(&dummy, zero, zero);
+            continue;
+        }
+
+        // Clip to the domain so that ghost cells are never read
+        const auto vbx = mfi.validbox() & domain;
+
+        // Hyperslab of the input grid that covers this box
+        amrex::GpuArray<int, AMREX_SPACEDIM> s0;
+        amrex::GpuArray<int, AMREX_SPACEDIM> s1;
+        std::vector<size_t> start(AMREX_SPACEDIM);
+        std::vector<size_t> count(AMREX_SPACEDIM);
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            s0[d] = src_index(
+                vbx.smallEnd(d) - domain.smallEnd(d), nmesh[d], nsrc[d],
+                false);
+            s1[d] = src_index(
+                vbx.bigEnd(d) - domain.smallEnd(d), nmesh[d], nsrc[d], true);
+            start[d] = static_cast<size_t>(s0[d]);
+            count[d] = static_cast<size_t>(s1[d] - s0[d] + 1);
+        }
+
+        const size_t dlen = count[0] * count[1] * count[2];
+        uvel_h.resize(dlen);
+        vvel_h.resize(dlen);
+        wvel_h.resize(dlen);
+        uvel_d.resize(dlen);
+        vvel_d.resize(dlen);
+        wvel_d.resize(dlen);
 
         // Read the velocity components u, v, w and copy to device
-        uvel.get(tmp.data(), start, count);
-        amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, &tmp[0], &tmp[dlen - 1] + 1,
+        uvel.get(uvel_h.data(), start, count);
+        vvel.get(vvel_h.data(), start, count);
+        wvel.get(wvel_h.data(), start, count);
+        amrex::Gpu::copyAsync(
+            amrex::Gpu::hostToDevice, uvel_h.begin(), uvel_h.end(),
             uvel_d.begin());
-        vvel.get(tmp.data(), start, count);
-        amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, &tmp[0], &tmp[dlen - 1] + 1,
+        amrex::Gpu::copyAsync(
+            amrex::Gpu::hostToDevice, vvel_h.begin(), vvel_h.end(),
             vvel_d.begin());
-        wvel.get(tmp.data(), start, count);
-        amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, &tmp[0], &tmp[dlen - 1] + 1,
+        amrex::Gpu::copyAsync(
+            amrex::Gpu::hostToDevice, wvel_h.begin(), wvel_h.end(),
             wvel_d.begin());
 
         // Pointers to velocity objects
@@ -95,29 +161,65 @@ bool ABLFieldInitFile::operator()(
         const auto* wvel_dptr = wvel_d.data();
 
         // Get count components for device
-        int ct1 = count[1];
-        int ct2 = count[2];
-
-        // Amrex parallel for to assign the velocity at each point
+        const int ct1 = static_cast<int>(count[1]);
+        const int ct2 = static_cast<int>(count[2]);
+        const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> ratio{
+            static_cast<amrex::Real>(nsrc[0]) / nmesh[0],
+            static_cast<amrex::Real>(nsrc[1]) / nmesh[1],
+            static_cast<amrex::Real>(nsrc[2]) / nmesh[2]};
+
+        const auto& vel = velocity.array(mfi);
         amrex::ParallelFor(
             vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                // The counter to go from 3d to 1d vector
-                auto idx = (i - i0) * ct2 * ct1 + (j - j0) * ct1 + (k - k0);
-                // Pass values from temporary array to the velocity field
-                velocity(i, j, k, 0) = uvel_dptr[idx];
-                velocity(i, j, k, 1) = vvel_dptr[idx];
-                velocity(i, j, k, 2) = wvel_dptr[idx];
+                const amrex::IntVect iv(i - dlo.x, j - dlo.y, k - dlo.z);
+                // Left and right input indices (relative to the hyperslab)
+                // and the weight of the right neighbor in each direction
+                amrex::GpuArray<int, AMREX_SPACEDIM> il;
+                amrex::GpuArray<int, AMREX_SPACEDIM> ir;
+                amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> wr;
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    const amrex::Real xi = (iv[d] + 0.5) * ratio[d] - 0.5;
+                    const int ii = amrex::max(
+                        s0[d], amrex::min(
+                                   static_cast<int>(std::floor(xi)), s1[d]));
+                    il[d] = ii - s0[d];
+                    ir[d] = amrex::min(ii + 1, s1[d]) - s0[d];
+                    wr[d] = amrex::max<amrex::Real>(
+                        0.0, amrex::min<amrex::Real>(1.0, xi - ii));
+                }
+
+                amrex::Real uu = 0.0;
+                amrex::Real vv = 0.0;
+                amrex::Real ww = 0.0;
+                for (int c = 0; c < 8; ++c) {
+                    const int ci = (c & 1) != 0 ? ir[0] : il[0];
+                    const int cj = (c & 2) != 0 ? ir[1] : il[1];
+                    const int ck = (c & 4) != 0 ? ir[2] : il[2];
+                    const amrex::Real wt =
+                        ((c & 1) != 0 ? wr[0] : 1.0 - wr[0]) *
+                        ((c & 2) != 0 ? wr[1] : 1.0 - wr[1]) *
+                        ((c & 4) != 0 ? wr[2] : 1.0 - wr[2]);
+                    // The counter to go from 3d to 1d vector
+                    const int idx = (ci * ct1 + cj) * ct2 + ck;
+                    uu += wt * uvel_dptr[idx];
+                    vv += wt * vvel_dptr[idx];
+                    ww += wt * wvel_dptr[idx];
+                }
+                vel(i, j, k, 0) = uu;
+                vel(i, j, k, 1) = vv;
+                vel(i, j, k, 2) = ww;
             });
-        // Close the netcdf file
-        ncf.close();
-        // Populated directly, do not fill from another level
-        return false;
-    } else {
-        // Skip level and interpolate data from already loaded coarse levels
-        return true;
+        // The working vectors are reused for the next box
+        amrex::Gpu::streamSynchronize();
+        ++mfi;
     }
+
+    // Close the netcdf file
+    ncf.close();
+    // Populated directly, do not fill from another level
+    return false;
 #else
-    amrex::ignore_unused(vbx, geom, velocity, lev);
+    amrex::ignore_unused(geom, velocity, lev);
     return false;
 #endif
 }
@@ -30,7 +30,15 @@ ABLStats::ABLStats(
     , m_pa_tu(m_pa_vel, m_pa_temp)
     , m_pa_uu(m_pa_vel, m_pa_vel)
     , m_pa_uuu(m_pa_vel, m_pa_vel, m_pa_vel)
-{}
+{
+    m_pa_fused.add(m_pa_vel);
+    m_pa_fused.add(m_pa_temp);
+    m_pa_fused.add(m_pa_mueff);
+    m_pa_fused.add(m_pa_tt);
+    m_pa_fused.add(m_pa_tu);
+    m_pa_fused.add(m_pa_uu);
+    m_pa_fused.add(m_pa_uuu);
+}
 
 ABLStats::~ABLStats() = default;
 
@@ -56,6 +64,7 @@ void ABLStats::initialize()
         m_gravity = utils::vec_mag(gravity.data());
         pp.get("reference_temperature", m_ref_theta);
         pp.query("stats_do_energy_budget", m_do_energy_budget);
+        pp.query("stats_parallel_netcdf", m_par_netcdf);
     }
 
     // Get normal direction and associated stuff
@@ -86,13 +95,11 @@ void ABLStats::initialize()
     }
 }
 
-void ABLStats::calc_averages()
+void ABLStats::calc_averages(const bool compute_moments)
 {
-    m_pa_vel();
-    m_pa_temp();
+    m_pa_fused(compute_moments);
     m_pa_vel_fine();
     m_pa_temp_fine();
-    m_pa_mueff();
 }
 
 //! Calculate sfs stress averages
@@ -206,23 +213,21 @@ void ABLStats::post_advance_work()
 {
     BL_PROFILE("amr-wind::ABLStats::post_advance_work");
 
-    // Always compute mean velocity/temperature profiles
-    calc_averages();
-
     const auto& time = m_sim.time();
     const int tidx = time.time_index();
+    const bool is_output_step = (tidx % m_out_freq == 0);
+
+    // Always compute mean velocity/temperature profiles, higher moments are
+    // only required on output timesteps
+    calc_averages(is_output_step);
+
     // Skip processing if it is not an output timestep
-    if (!(tidx % m_out_freq == 0)) {
+    if (!is_output_step) {
         return;
     }
 
     compute_zi();
 
-    m_pa_tt();
-    m_pa_tu();
-    m_pa_uu();
-    m_pa_uuu();
-
     process_output();
 }
 
@@ -397,15 +402,56 @@ void ABLStats::prepare_netcdf_file()
     }
     m_ncfile_name = stat_dir + "/" + sname + ".nc";
 
+    if (m_par_netcdf) {
+        // All ranks participate in the file creation and the file is kept open
+        // for the remainder of the simulation
+        m_ncf = std::make_unique<ncutils::NCFile>(ncutils::NCFile::create_par(
+            m_ncfile_name, NC_CLOBBER | NC_NETCDF4 | NC_MPIIO,
+            amrex::ParallelDescriptor::Communicator(), MPI_INFO_NULL));
+        define_netcdf_file(*m_ncf);
+        m_ncf->sync();
+        return;
+    }
+
     // Only I/O processor handles NetCDF generation
     if (!amrex::ParallelDescriptor::IOProcessor()) return;
 
     auto ncf = ncutils::NCFile::create(m_ncfile_name, NC_CLOBBER | NC_NETCDF4);
+    define_netcdf_file(ncf);
+
+#else
+    amrex::Abort(
+        "NetCDF support was not enabled during build time. Please recompile or "
+        "use native format");
+#endif
+}
+
+std::pair<size_t, size_t> ABLStats::profile_range(const size_t n_levels) const
+{
+    if (!m_par_netcdf) {
+        return {0, n_levels};
+    }
+    const size_t nprocs = amrex::ParallelDescriptor::NProcs();
+    const size_t iproc = amrex::ParallelDescriptor::MyProc();
+    return {(n_levels * iproc) / nprocs, (n_levels * (iproc + 1)) / nprocs};
+}
+
+void ABLStats::define_netcdf_file(const ncutils::NCFile& ncf)
+{
+#ifdef AMR_WIND_USE_NETCDF
+    // Metadata must be identical on all ranks for parallel I/O
+    std::string tstamp = ioutils::timestamp();
+    if (m_par_netcdf) {
+        amrex::ParallelDescriptor::Bcast(
+            tstamp.data(), tstamp.size(),
+            amrex::ParallelDescriptor::IOProcessorNumber());
+    }
+
     const std::string nt_name = "num_time_steps";
     ncf.enter_def_mode();
     ncf.put_attr("title", "AMR-Wind ABL statistics output");
     ncf.put_attr("version", ioutils::amr_wind_version());
-    ncf.put_attr("created_on", ioutils::timestamp());
+    ncf.put_attr("created_on", tstamp);
     ncf.def_dim(nt_name, NC_UNLIMITED);
     ncf.def_dim("ndim", AMREX_SPACEDIM);
 
@@ -466,18 +512,19 @@ void ABLStats::prepare_netcdf_file()
     }
 
     ncf.exit_def_mode();
+    if (m_par_netcdf) {
+        ncf.par_access(NC_COLLECTIVE);
+    }
 
     {
-        const std::vector<size_t> start{0};
-        std::vector<size_t> count{n_levels};
+        const auto prange = profile_range(n_levels);
+        const std::vector<size_t> start{prange.first};
+        std::vector<size_t> count{prange.second - prange.first};
         auto h = grp.var("h");
-        h.put(m_pa_vel.line_centroids().data(), start, count);
+        h.put(m_pa_vel.line_centroids().data() + prange.first, start, count);
     }
-
 #else
-    amrex::Abort(
-        "NetCDF support was not enabled during build time. Please recompile or "
-        "use native format");
+    amrex::ignore_unused(ncf);
 #endif
 }
 
@@ -495,68 +542,95 @@ void ABLStats::write_netcdf()
         *t_sfs_stress, m_sim.time(), m_normal_dir);
     pa_tsfs();
 
+    if (m_par_netcdf) {
+        write_netcdf_data(*m_ncf, pa_sfs, pa_tsfs);
+        m_ncf->sync();
+        return;
+    }
+
     if (!amrex::ParallelDescriptor::IOProcessor()) return;
     auto ncf = ncutils::NCFile::open(m_ncfile_name, NC_WRITE);
+    write_netcdf_data(ncf, pa_sfs, pa_tsfs);
+    ncf.close();
+#endif
+}
+
+/** Write the statistics for the current timestep into the NetCDF file
+ *
+ *  With parallel I/O, the scalar time series are written by the IO rank and
+ *  each rank writes its own chunk of the mean profiles collectively.
+ */
+void ABLStats::write_netcdf_data(
+    const ncutils::NCFile& ncf,
+    ScratchFieldPlaneAveraging& pa_sfs,
+    ScratchFieldPlaneAveraging& pa_tsfs)
+{
+#ifdef AMR_WIND_USE_NETCDF
     const std::string nt_name = "num_time_steps";
     // Index of the next timestep
     const size_t nt = ncf.dim(nt_name).len();
+    // Only one rank writes the scalar time series
+    const size_t nscalar = amrex::ParallelDescriptor::IOProcessor() ? 1 : 0;
     {
         auto time = m_sim.time().new_time();
-        ncf.var("time").put(&time, {nt}, {1});
+        ncf.var("time").put(&time, {nt}, {nscalar});
         auto ustar = m_abl_wall_func.utau();
-        ncf.var("ustar").put(&ustar, {nt}, {1});
+        ncf.var("ustar").put(&ustar, {nt}, {nscalar});
         double wstar = 0.0;
         auto Q = m_abl_wall_func.mo().surf_temp_flux;
-        ncf.var("Q").put(&Q, {nt}, {1});
+        ncf.var("Q").put(&Q, {nt}, {nscalar});
         auto Tsurf = m_abl_wall_func.mo().surf_temp;
-        ncf.var("Tsurf").put(&Tsurf, {nt}, {1});
+        ncf.var("Tsurf").put(&Tsurf, {nt}, {nscalar});
         if (Q > 1e-10) wstar = std::cbrt(m_gravity * Q * m_zi / m_ref_theta);
-        ncf.var("wstar").put(&wstar, {nt}, {1});
+        ncf.var("wstar").put(&wstar, {nt}, {nscalar});
         double L = m_abl_wall_func.mo().obukhov_len;
-        ncf.var("L").put(&L, {nt}, {1});
-        ncf.var("zi").put(&m_zi, {nt}, {1});
+        ncf.var("L").put(&L, {nt}, {nscalar});
+        ncf.var("zi").put(&m_zi, {nt}, {nscalar});
 
         amrex::RealArray abl_forcing = {{0.0, 0.0, 0.0}};
         if (m_abl_forcing != nullptr) {
             abl_forcing = m_abl_forcing->abl_forcing();
         }
-        ncf.var("abl_forcing_x").put(&abl_forcing[0], {nt}, {1});
-        ncf.var("abl_forcing_y").put(&abl_forcing[1], {nt}, {1});
+        ncf.var("abl_forcing_x").put(&abl_forcing[0], {nt}, {nscalar});
+        ncf.var("abl_forcing_y").put(&abl_forcing[1], {nt}, {nscalar});
 
         auto grp = ncf.group("mean_profiles");
         size_t n_levels = m_pa_vel.ncell_line();
         amrex::Vector<amrex::Real> l_vec(n_levels);
-        std::vector<size_t> start{nt, 0};
-        std::vector<size_t> count{1, n_levels};
+        const auto prange = profile_range(n_levels);
+        const size_t poff = prange.first;
+        std::vector<size_t> start{nt, prange.first};
+        std::vector<size_t> count{1, prange.second - prange.first};
 
         {
             amrex::Vector<std::string> var_names{"u", "v", "w"};
             for (int i = 0; i < AMREX_SPACEDIM; i++) {
                 m_pa_vel.line_average(i, l_vec);
                 auto var = grp.var(var_names[i]);
-                var.put(l_vec.data(), start, count);
+                var.put(l_vec.data() + poff, start, count);
             }
         }
 
         {
             auto var = grp.var("hvelmag");
-            var.put(m_pa_vel.line_hvelmag_average().data(), start, count);
+            var.put(
+                m_pa_vel.line_hvelmag_average().data() + poff, start, count);
         }
 
         {
             auto var = grp.var("theta");
-            var.put(m_pa_temp.line_average().data(), start, count);
+            var.put(m_pa_temp.line_average().data() + poff, start, count);
         }
 
         {
             auto var = grp.var("mueff");
-            var.put(m_pa_mueff.line_average().data(), start, count);
+            var.put(m_pa_mueff.line_average().data() + poff, start, count);
         }
 
         {
             auto var = grp.var("theta'theta'_r");
             m_pa_tt.line_moment(0, l_vec);
-            var.put(l_vec.data(), start, count);
+            var.put(l_vec.data() + poff, start, count);
         }
 
         {
@@ -565,7 +639,7 @@ void ABLStats::write_netcdf()
             for (int i = 0; i < AMREX_SPACEDIM; i++) {
                 m_pa_tu.line_moment(i, l_vec);
                 auto var = grp.var(var_names[i]);
-                var.put(l_vec.data(), start, count);
+                var.put(l_vec.data() + poff, start, count);
             }
         }
 
@@ -576,7 +650,7 @@ void ABLStats::write_netcdf()
             for (int i = 0; i < var_comp.size(); i++) {
                 m_pa_uu.line_moment(var_comp[i], l_vec);
                 auto var = grp.var(var_names[i]);
-                var.put(l_vec.data(), start, count);
+                var.put(l_vec.data() + poff, start, count);
             }
         }
 
@@ -587,7 +661,7 @@ void ABLStats::write_netcdf()
             for (int i = 0; i < var_comp.size(); i++) {
                 m_pa_uuu.line_moment(var_comp[i], l_vec);
                 auto var = grp.var(var_names[i]);
-                var.put(l_vec.data(), start, count);
+                var.put(l_vec.data() + poff, start, count);
             }
         }
 
@@ -597,7 +671,7 @@ void ABLStats::write_netcdf()
             for (int i = 0; i < AMREX_SPACEDIM; i++) {
                 pa_sfs.line_average(i, l_vec);
                 auto var = grp.var(var_names[i]);
-                var.put(l_vec.data(), start, count);
+                var.put(l_vec.data() + poff, start, count);
             }
         }
 
@@ -607,7 +681,7 @@ void ABLStats::write_netcdf()
             for (int i = 0; i < AMREX_SPACEDIM; i++) {
                 pa_tsfs.line_average(i, l_vec);
                 auto var = grp.var(var_names[i]);
-                var.put(l_vec.data(), start, count);
+                var.put(l_vec.data() + poff, start, count);
             }
         }
 
@@ -628,28 +702,34 @@ void ABLStats::write_netcdf()
                     tke_dissip, m_sim.time(), m_normal_dir);
                 pa_tke_buoy_prod();
                 auto var = grp.var("tke_buoy");
-                var.put(pa_tke_buoy_prod.line_average().data(), start, count);
+                var.put(
+                    pa_tke_buoy_prod.line_average().data() + poff, start,
+                    count);
             }
             {
                 FieldPlaneAveraging pa_tke_shear_prod(
                     tke_shear_prod, m_sim.time(), m_normal_dir);
                 pa_tke_shear_prod();
                 auto var = grp.var("tke_shear");
-                var.put(pa_tke_shear_prod.line_average().data(), start, count);
+                var.put(
+                    pa_tke_shear_prod.line_average().data() + poff, start,
+                    count);
             }
             {
                 FieldPlaneAveraging pa_tke_dissip(
                     tke_dissip, m_sim.time(), m_normal_dir);
                 pa_tke_dissip();
                 auto var = grp.var("tke_dissip");
-                var.put(pa_tke_dissip.line_average().data(), start, count);
+                var.put(
+                    pa_tke_dissip.line_average().data() + poff, start, count);
             }
             {
                 ScratchFieldPlaneAveraging pa_tke_diff(
                     *tke_diffusion, m_sim.time(), m_normal_dir);
                 pa_tke_diff();
                 auto var = grp.var("tke_diff");
-                var.put(pa_tke_diff.line_average().data(), start, count);
+                var.put(
+                    pa_tke_diff.line_average().data() + poff, start, count);
             }
         }
     }
@@ -3,6 +3,7 @@
 #include "amr-wind/wind_energy/actuator/ActParser.H"
 #include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
 #include "amr-wind/CFDSim.H"
+#include "amr-wind/utilities/PerfTimers.H"
 #include "amr-wind/core/FieldRepo.H"
 
 #include <algorithm>
@@ -23,6 +24,7 @@ void Actuator::pre_init_actions()
 
     amrex::Vector<std::string> labels;
     pp.getarr("labels", labels);
+    pp.query("use_sub_communicators", m_use_sub_comms);
 
     const int nturbines = static_cast<int>(labels.size());
 
@@ -86,6 +88,7 @@ void Actuator::post_regrid_actions()
 void Actuator::pre_advance_work()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::pre_advance_work");
+    auto timer = m_sim.perf_timers().scope("actuator");
 
     m_container->reset_container();
     update_positions();
@@ -132,7 +135,9 @@ void Actuator::communicate_turbine_io()
  *
  *  Allocates memory and initializes the particles corresponding to actuator
  *  nodes for all turbines that influence the current MPI rank. This method is
- *  invoked once during initialization and during regrid step.
+ *  invoked once during initialization and during regrid step. When
+ *  `Actuator.use_sub_communicators` is enabled, the sampled velocities of each
+ *  turbine are exchanged only among the MPI ranks involved with that turbine.
  */
 void Actuator::setup_container()
 {
@@ -154,6 +159,16 @@ void Actuator::setup_container()
         }
     }
 
+    if (m_use_sub_comms) {
+        amrex::Vector<amrex::RealBox> bound_boxes(ntotal);
+        amrex::Vector<std::set<int>> procs(ntotal);
+        for (int i = 0; i < ntotal; ++i) {
+            bound_boxes[i] = m_actuators[i]->info().bound_box;
+            procs[i] = m_actuators[i]->info().procs;
+        }
+        m_container->use_sub_communicators(bound_boxes, procs);
+    }
+
     m_container->initialize_container();
 }
 
@@ -1,5 +1,6 @@
 #include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
 #include "amr-wind/wind_energy/actuator/Actuator.H"
+#include "amr-wind/wind_energy/actuator/actuator_utils.H"
 #include "amr-wind/core/gpu_utils.H"
 #include "amr-wind/core/Field.H"
 
@@ -29,6 +30,19 @@ ActuatorContainer::ActuatorContainer(
     , m_proc_offsets_device(amrex::ParallelDescriptor::NProcs() + 1)
 {}
 
+ActuatorContainer::~ActuatorContainer() { free_communicators(); }
+
+void ActuatorContainer::use_sub_communicators(
+    const amrex::Vector<amrex::RealBox>& bound_boxes,
+    const amrex::Vector<std::set<int>>& procs)
+{
+    AMREX_ALWAYS_ASSERT(bound_boxes.size() == procs.size());
+    free_communicators();
+    m_bound_boxes = bound_boxes;
+    m_act_procs = procs;
+    m_use_sub_comms = true;
+}
+
 /** Allocate memory and initialize the particles within the container
  *
  *  This method is only called once during the simulation. It allocates the
@@ -90,6 +104,20 @@ void ActuatorContainer::initialize_particles(const int total_pts)
     AMREX_ALWAYS_ASSERT(id_start == 1U);
     const int iproc = amrex::ParallelDescriptor::MyProc();
 
+    // Actuator global ID and index within the actuator for every point
+    amrex::Vector<int> pt_gid(total_pts, -1);
+    amrex::Vector<int> pt_lid(total_pts, 0);
+    for (int i = 0, ic = 0; i < m_data.num_objects; ++i) {
+        for (int ip = 0; ip < m_data.num_pts[i]; ++ip, ++ic) {
+            pt_gid[ic] = m_data.global_id[i];
+            pt_lid[ic] = ip;
+        }
+    }
+    const auto dgid = gpu::device_view(pt_gid);
+    const auto dlid = gpu::device_view(pt_lid);
+    const auto* gid_ptr = dgid.data();
+    const auto* lid_ptr = dlid.data();
+
     // Flag indicating if a tile was found where all particles were deposited.
     bool assigned = false;
     const int nlevels = m_mesh.finestLevel() + 1;
@@ -107,11 +135,14 @@ void ActuatorContainer::initialize_particles(const int total_pts)
 
                     pp.id() = id_start + ip;
                     pp.cpu() = iproc;
-                    pp.idata(0) = ip;
+                    pp.idata(AIx::nid) = ip;
+                    pp.idata(AIx::gid) = gid_ptr[ip];
+                    pp.idata(AIx::lid) = lid_ptr[ip];
                 });
             assigned = true;
         }
     }
+    amrex::Gpu::streamSynchronize();
 
     // Indicate that we have initialized the containers and remaining methods
     // are safe to use
@@ -157,6 +188,10 @@ void ActuatorContainer::update_positions()
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::update_positions");
     AMREX_ALWAYS_ASSERT(m_container_initialized && !m_is_scattered);
 
+    if (m_use_sub_comms && !m_comms_initialized) {
+        setup_communicators();
+    }
+
     const auto dpos = gpu::device_view(m_data.position);
     const auto* const dptr = dpos.data();
     const int nlevels = m_mesh.finestLevel() + 1;
@@ -167,7 +202,7 @@ void ActuatorContainer::update_positions()
 
             amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
                 auto& pp = pstruct[ip];
-                const auto idx = pp.idata(0);
+                const auto idx = pp.idata(AIx::nid);
 
                 const auto& pvec = dptr[idx];
                 for (int n = 0; n < AMREX_SPACEDIM; ++n) {
@@ -207,7 +242,11 @@ void ActuatorContainer::sample_fields(const Field& vel, const Field& density)
     // Redistribute();
 
     // Populate the velocity buffer that all actuator instances can access
-    populate_field_buffers();
+    if (m_use_sub_comms) {
+        populate_field_buffers_sub_comms();
+    } else {
+        populate_field_buffers();
+    }
 
     // Indicate that the particles have been restored to their original MPI rank
     m_is_scattered = false;
@@ -240,7 +279,7 @@ void ActuatorContainer::populate_field_buffers()
             amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
                 auto& pp = pstruct[ip];
                 const auto iproc = pp.cpu();
-                const auto idx = offsets[iproc] + pp.idata(0);
+                const auto idx = offsets[iproc] + pp.idata(AIx::nid);
 
                 for (int n = 0; n < NumPStructReal; ++n) {
                     buffer_pointer[idx * NumPStructReal + n] = pp.rdata(n);
@@ -273,6 +312,270 @@ void ActuatorContainer::populate_field_buffers()
     }
 }
 
+/** Helper method for ActuatorContainer::sample_fields
+ *
+ *  Same as ActuatorContainer::populate_field_buffers, but the sampled values
+ *  of each actuator are only reduced across the ranks of its communication
+ *  group. The reductions for all actuators are started before waiting on any
+ *  of them.
+ */
+void ActuatorContainer::populate_field_buffers_sub_comms()
+{
+    BL_PROFILE(
+        "amr-wind::actuator::ActuatorContainer::populate_field_buffers_sub_"
+        "comms");
+    const size_t num_buff_entries = m_comm_buf_size;
+
+    amrex::Vector<amrex::Real> buff_host(num_buff_entries);
+    amrex::Gpu::DeviceVector<amrex::Real> buff_device(num_buff_entries, 0.0);
+    amrex::Gpu::DeviceScalar<int> num_escaped(0);
+    amrex::Gpu::DeviceScalar<int> num_unknown(0);
+
+    auto* buffer_pointer = buff_device.data();
+    auto* escaped = num_escaped.dataPtr();
+    auto* unknown = num_unknown.dataPtr();
+    const auto* buf_offsets = m_comm_buf_offsets_device.data();
+    const auto* org_offsets = m_origin_offsets_device.data();
+    const auto* origins = m_origins_device.data();
+    const auto* act_npts = m_comm_npts_device.data();
+
+    const int nlevels = m_mesh.finestLevel() + 1;
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+
+            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                auto& pp = pstruct[ip];
+                const int gid = pp.idata(AIx::gid);
+                const int boff = buf_offsets[gid];
+                // Point sampled outside the communication group
+                if (boff < 0) {
+                    amrex::Gpu::Atomic::AddNoRet(escaped, 1);
+                    return;
+                }
+
+                int slot = -1;
+                for (int io = org_offsets[gid]; io < org_offsets[gid + 1];
+                     ++io) {
+                    if (origins[io] == pp.cpu()) {
+                        slot = io - org_offsets[gid];
+                    }
+                }
+                // Origin rank not registered with the communication group
+                if (slot < 0) {
+                    amrex::Gpu::Atomic::AddNoRet(unknown, 1);
+                    return;
+                }
+                const auto idx =
+                    boff + (slot * act_npts[gid] + pp.idata(AIx::lid)) *
+                               NumPStructReal;
+
+                for (int n = 0; n < NumPStructReal; ++n) {
+                    buffer_pointer[idx + n] = pp.rdata(n);
+                }
+            });
+        }
+    }
+
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, buff_device.begin(), buff_device.end(),
+        buff_host.begin());
+    if (num_escaped.dataValue() > 0) {
+        amrex::Abort(
+            "ActuatorContainer: velocity sampled outside of actuator "
+            "communication group. Set Actuator.use_sub_communicators = false");
+    }
+    if (num_unknown.dataValue() > 0) {
+        amrex::Abort(
+            "ActuatorContainer: actuator point from a rank that is not an "
+            "origin of its communication group");
+    }
+
+#ifdef AMREX_USE_MPI
+    const int nact = static_cast<int>(m_comms.size());
+    amrex::Vector<MPI_Request> requests;
+    requests.reserve(nact);
+    for (int ig = 0; ig < nact; ++ig) {
+        const auto& acomm = m_comms[ig];
+        if (!acomm.is_member || (acomm.ranks.size() < 2)) {
+            continue;
+        }
+        const int num_entries = static_cast<int>(acomm.origins.size()) *
+                                acomm.num_pts * NumPStructReal;
+        requests.emplace_back();
+        MPI_Iallreduce(
+            MPI_IN_PLACE, &buff_host[m_comm_buf_offsets[ig]], num_entries,
+            amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type(),
+            MPI_SUM, acomm.comm, &requests.back());
+    }
+    MPI_Waitall(
+        static_cast<int>(requests.size()), requests.data(),
+        MPI_STATUSES_IGNORE);
+#endif
+
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    auto& vel_arr = m_data.velocity;
+    auto& den_arr = m_data.density;
+    for (int i = 0, ic = 0; i < m_data.num_objects; ++i) {
+        const int ig = m_data.global_id[i];
+        const auto& acomm = m_comms[ig];
+        const auto it =
+            std::find(acomm.origins.begin(), acomm.origins.end(), iproc);
+        const auto slot =
+            static_cast<int>(std::distance(acomm.origins.begin(), it));
+        const int ioff = m_comm_buf_offsets[ig] / NumPStructReal +
+                         slot * acomm.num_pts;
+        for (int ip = 0; ip < m_data.num_pts[i]; ++ip, ++ic) {
+            for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+                vel_arr[ic][j] = buff_host[(ioff + ip) * NumPStructReal + j];
+            }
+            den_arr[ic] =
+                buff_host[(ioff + ip) * NumPStructReal + AMREX_SPACEDIM];
+        }
+    }
+}
+
+/** Create a communicator for every actuator
+ *
+ *  The communication group of an actuator contains the ranks where it is
+ *  active, and the ranks whose boxes intersect the region spanned by its
+ *  bounding box and its velocity sampling points. This method is collective
+ *  across all ranks and is invoked once after the container is created, i.e.,
+ *  during initialization and after every regrid.
+ */
+void ActuatorContainer::setup_communicators()
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorContainer::setup_communicators");
+    free_communicators();
+
+    const int nact = static_cast<int>(m_bound_boxes.size());
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+
+    // Region spanned by the bounding box and the velocity sampling points
+    amrex::Vector<amrex::Real> rlo(nact * AMREX_SPACEDIM);
+    amrex::Vector<amrex::Real> rhi(nact * AMREX_SPACEDIM);
+    for (int ig = 0; ig < nact; ++ig) {
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            rlo[ig * AMREX_SPACEDIM + n] = m_bound_boxes[ig].lo(n);
+            rhi[ig * AMREX_SPACEDIM + n] = m_bound_boxes[ig].hi(n);
+        }
+    }
+    for (int i = 0, ic = 0; i < m_data.num_objects; ++i) {
+        const int ig = m_data.global_id[i];
+        for (int ip = 0; ip < m_data.num_pts[i]; ++ip, ++ic) {
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                auto& lo = rlo[ig * AMREX_SPACEDIM + n];
+                auto& hi = rhi[ig * AMREX_SPACEDIM + n];
+                lo = amrex::min(lo, m_data.position[ic][n]);
+                hi = amrex::max(hi, m_data.position[ic][n]);
+            }
+        }
+    }
+    amrex::ParallelDescriptor::ReduceRealMin(
+        rlo.data(), static_cast<int>(rlo.size()));
+    amrex::ParallelDescriptor::ReduceRealMax(
+        rhi.data(), static_cast<int>(rhi.size()));
+
+    // Points required by each actuator on this rank (0 if not an origin)
+    amrex::Vector<int> local_npts(nact, 0);
+    for (int i = 0; i < m_data.num_objects; ++i) {
+        local_npts[m_data.global_id[i]] = m_data.num_pts[i];
+    }
+
+    m_comms.resize(nact);
+    m_comm_buf_offsets.assign(nact, -1);
+    m_origin_offsets.assign(nact + 1, 0);
+    amrex::Vector<int> all_origins;
+    amrex::Vector<int> all_npts(nact, 0);
+    m_comm_buf_size = 0;
+
+#ifdef AMREX_USE_MPI
+    MPI_Group world_group;
+    MPI_Comm_group(amrex::ParallelDescriptor::Communicator(), &world_group);
+#endif
+
+    for (int ig = 0; ig < nact; ++ig) {
+        auto& acomm = m_comms[ig];
+        const amrex::RealBox rbx(
+            &rlo[ig * AMREX_SPACEDIM], &rhi[ig * AMREX_SPACEDIM]);
+        auto procs = utils::determine_influenced_procs(m_mesh, rbx);
+        procs.insert(m_act_procs[ig].begin(), m_act_procs[ig].end());
+        acomm.ranks.assign(procs.begin(), procs.end());
+        acomm.is_member = (procs.find(iproc) != procs.end());
+
+        if (acomm.is_member) {
+            const int nranks = static_cast<int>(acomm.ranks.size());
+            amrex::Vector<int> grp_npts(nranks, 0);
+#ifdef AMREX_USE_MPI
+            MPI_Group grp;
+            MPI_Group_incl(world_group, nranks, acomm.ranks.data(), &grp);
+            MPI_Comm_create_group(
+                amrex::ParallelDescriptor::Communicator(), grp, ig,
+                &acomm.comm);
+            MPI_Group_free(&grp);
+            MPI_Allgather(
+                &local_npts[ig], 1, MPI_INT, grp_npts.data(), 1, MPI_INT,
+                acomm.comm);
+#else
+            grp_npts[0] = local_npts[ig];
+#endif
+            for (int ir = 0; ir < nranks; ++ir) {
+                if (grp_npts[ir] > 0) {
+                    acomm.origins.push_back(acomm.ranks[ir]);
+                    acomm.num_pts = grp_npts[ir];
+                }
+            }
+
+            m_comm_buf_offsets[ig] = static_cast<int>(m_comm_buf_size);
+            m_comm_buf_size += static_cast<size_t>(acomm.origins.size()) *
+                               acomm.num_pts * NumPStructReal;
+        }
+
+        all_origins.insert(
+            all_origins.end(), acomm.origins.begin(), acomm.origins.end());
+        m_origin_offsets[ig + 1] = static_cast<int>(all_origins.size());
+        all_npts[ig] = acomm.num_pts;
+    }
+
+#ifdef AMREX_USE_MPI
+    MPI_Group_free(&world_group);
+#endif
+
+    m_comm_buf_offsets_device.resize(nact);
+    m_origin_offsets_device.resize(nact + 1);
+    m_origins_device.resize(all_origins.size());
+    m_comm_npts_device.resize(nact);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_comm_buf_offsets.begin(),
+        m_comm_buf_offsets.end(), m_comm_buf_offsets_device.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_origin_offsets.begin(),
+        m_origin_offsets.end(), m_origin_offsets_device.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, all_origins.begin(), all_origins.end(),
+        m_origins_device.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, all_npts.begin(), all_npts.end(),
+        m_comm_npts_device.begin());
+
+    m_comms_initialized = true;
+}
+
+void ActuatorContainer::free_communicators()
+{
+#ifdef AMREX_USE_MPI
+    for (auto& acomm : m_comms) {
+        if (acomm.comm != MPI_COMM_NULL) {
+            MPI_Comm_free(&acomm.comm);
+        }
+    }
+#endif
+    m_comms.clear();
+    m_comms_initialized = false;
+}
+
 /** Helper method for ActuatorContainer::sample_fields
  *
  *  Performs a trilinear interpolation of the velocity/desnity field to particle
@@ -1,8 +1,8 @@
 #include "amr-wind/wind_energy/actuator/aero/AirfoilTable.H"
-#include "amr-wind/utilities/linear_interpolation.H"
 
 #include <fstream>
 #include <algorithm>
+#include <cmath>
 
 namespace amr_wind::actuator {
 
@@ -15,8 +15,7 @@ AirfoilTable::~AirfoilTable() = default;
 void AirfoilTable::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    const vs::Vector polar = view()(aoa);
     cl = polar.x();
     cd = polar.y();
 }
@@ -27,13 +26,61 @@ void AirfoilTable::operator()(
     amrex::Real& cd,
     amrex::Real& cm) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    const vs::Vector polar = view()(aoa);
     cl = polar.x();
     cd = polar.y();
     cm = polar.z();
 }
 
+AirfoilLookupView AirfoilTable::view() const
+{
+    AirfoilLookupView lookup;
+    lookup.aoa = m_aoa.data();
+    lookup.polar = m_polar.data();
+    lookup.bin_index = m_bin_index.data();
+    lookup.num_entries = num_entries();
+    lookup.num_bins = num_bins();
+    lookup.aoa_min = m_aoa_min;
+    lookup.inv_dbin = m_inv_dbin;
+    return lookup;
+}
+
+void AirfoilTable::build_lookup()
+{
+    BL_PROFILE("amr-wind::actuator::AirfoilTable::build_lookup");
+    const int npts = num_entries();
+    m_bin_index.clear();
+    if (npts > 1) {
+        constexpr amrex::Real eps = 1.0e-8;
+        const amrex::Real span = m_aoa.back() - m_aoa.front();
+        amrex::Real dmin = span;
+        for (int i = 0; i < npts - 1; ++i) {
+            const amrex::Real daoa = m_aoa[i + 1] - m_aoa[i];
+            if (daoa > eps) {
+                dmin = amrex::min(dmin, daoa);
+            }
+        }
+
+        int nbins = 1;
+        if (span > eps) {
+            const auto nfine = static_cast<int>(std::ceil(span / dmin));
+            nbins = amrex::max(1, amrex::min(max_bins, nfine));
+        }
+        m_aoa_min = m_aoa.front();
+        m_inv_dbin = (span > eps) ? (nbins / span) : 0.0;
+        m_bin_index.resize(nbins);
+
+        int j = 0;
+        for (int ib = 0; ib < nbins; ++ib) {
+            const amrex::Real aoa_lo = m_aoa_min + ib * span / nbins;
+            while ((j < npts - 2) && (m_aoa[j + 1] <= aoa_lo)) {
+                ++j;
+            }
+            m_bin_index[ib] = j;
+        }
+    }
+}
+
 void ThinAirfoil::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
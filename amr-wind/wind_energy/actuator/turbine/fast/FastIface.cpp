@@ -9,6 +9,7 @@
 #include "AMReX_FileSystem.H"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 
 namespace exw_fast {
@@ -45,6 +46,13 @@ FastIface::FastIface(const amr_wind::CFDSim& /*unused*/) {}
 
 FastIface::~FastIface()
 {
+    try {
+        wait_for_all();
+    } catch (const std::exception& e) {
+        amrex::OutStream() << "\nFastIface: Error advancing turbines\n"
+                           << e.what() << std::endl;
+    }
+
     int ierr = ErrID_None;
     char err_msg[fast_strlen()];
     FAST_DeallocateTurbines(&ierr, err_msg);
@@ -111,6 +119,7 @@ int FastIface::register_turbine(FastTurbine& data)
     m_turbine_map[gid] = local_id;
     data.tid_local = local_id;
     m_turbine_data.emplace_back(&data);
+    m_pending_steps.emplace_back();
 
     return local_id;
 }
@@ -134,28 +143,23 @@ void FastIface::init_solution(const int local_id)
     fi.is_solution0 = false;
 }
 
-void FastIface::advance_turbine(const int local_id)
+void FastIface::check_stop_time(const FastTurbine& fi)
 {
-    BL_PROFILE("amr-wind::FastIface::advance_turbine");
-    AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
-
-    auto& fi = *m_turbine_data[local_id];
-    AMREX_ASSERT(!fi.is_solution0);
-    {
-        const auto& tmax = fi.stop_time;
-        const auto& telapsed = (fi.time_index + fi.num_substeps) * fi.dt_fast;
-        if (telapsed > (tmax + 1.0e-8)) {
-            // clang-format off
-            amrex::OutStream()
-                << "\nWARNING: FastIface:\n"
-                << "  Elapsed simulation time will exceed max "
-                << "time set for OpenFAST"
-                << std::endl << std::endl;
-            // clang-format on
-        }
+    const auto& tmax = fi.stop_time;
+    const auto& telapsed = (fi.time_index + fi.num_substeps) * fi.dt_fast;
+    if (telapsed > (tmax + 1.0e-8)) {
+        // clang-format off
+        amrex::OutStream()
+            << "\nWARNING: FastIface:\n"
+            << "  Elapsed simulation time will exceed max "
+            << "time set for OpenFAST"
+            << std::endl << std::endl;
+        // clang-format on
     }
+}
 
-    write_velocity_data(fi);
+void FastIface::fast_step_turbine(FastTurbine& fi)
+{
     for (int i = 0; i < fi.num_substeps; ++i, ++fi.time_index) {
         fast_func(FAST_OpFM_Step, &fi.tid_local);
     }
@@ -167,6 +171,76 @@ void FastIface::advance_turbine(const int local_id)
     }
 }
 
+void FastIface::advance_turbine(const int local_id)
+{
+    BL_PROFILE("amr-wind::FastIface::advance_turbine");
+    AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
+    wait_for_turbine(local_id);
+
+    auto& fi = *m_turbine_data[local_id];
+    AMREX_ASSERT(!fi.is_solution0);
+    check_stop_time(fi);
+
+    write_velocity_data(fi);
+    fast_step_turbine(fi);
+}
+
+void FastIface::advance_turbine_async(const int local_id)
+{
+    BL_PROFILE("amr-wind::FastIface::advance_turbine_async");
+    AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
+    wait_for_turbine(local_id);
+
+    auto& fi = *m_turbine_data[local_id];
+    AMREX_ASSERT(!fi.is_solution0);
+    check_stop_time(fi);
+
+    // File I/O through NetCDF is not thread-safe, record the velocities here
+    write_velocity_data(fi);
+
+    // The FAST library is not guaranteed to be thread-safe across turbines,
+    // so every step waits for the previously launched one to complete
+    auto previous = m_last_step;
+    m_last_step = std::async(std::launch::async, [this, &fi, previous]() {
+                      if (previous.valid()) {
+                          previous.wait();
+                      }
+                      fast_step_turbine(fi);
+                  }).share();
+    m_pending_steps[local_id] = m_last_step;
+}
+
+void FastIface::wait_for_turbine(const int local_id)
+{
+    AMREX_ASSERT(local_id < static_cast<int>(m_pending_steps.size()));
+    auto& pending = m_pending_steps[local_id];
+    if (!pending.valid()) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::FastIface::wait_for_turbine");
+    // Reset before get() so that an error is only reported once
+    auto step = std::move(pending);
+    pending = std::shared_future<void>();
+    step.get();
+}
+
+bool FastIface::is_pending(const int local_id) const
+{
+    AMREX_ASSERT(local_id < static_cast<int>(m_pending_steps.size()));
+    const auto& pending = m_pending_steps[local_id];
+    return pending.valid() && (pending.wait_for(std::chrono::seconds(0)) !=
+                               std::future_status::ready);
+}
+
+void FastIface::wait_for_all()
+{
+    for (int i = 0; i < static_cast<int>(m_pending_steps.size()); ++i) {
+        wait_for_turbine(i);
+    }
+    m_last_step = std::shared_future<void>();
+}
+
 void FastIface::init_turbine(const int local_id)
 {
     AMREX_ALWAYS_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
@@ -0,0 +1,157 @@
+/** \file airfoil_bench.cpp
+ *
+ *  Micro-benchmark of the airfoil polar lookups used by the actuator models.
+ *  The binned lookup of `AirfoilTable` is compared against the bisection
+ *  search of `interp::linear` on a synthetic polar.
+ *
+ *  Inputs (prefix `airfoil_bench`):
+ *
+ *  - `num_entries`: number of angles of attack in the polar (default 500)
+ *  - `num_lookups`: number of lookups per repetition, e.g., the total number
+ *     of blade sections of all turbines (default 100000)
+ *  - `num_repeats`: number of repetitions (default 10)
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include "amr-wind/wind_energy/actuator/aero/AirfoilTable.H"
+#include "amr-wind/utilities/linear_interpolation.H"
+#include "amr-wind/utilities/trig_ops.H"
+#include "amr-wind/utilities/console_io.H"
+
+#include "AMReX.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Random.H"
+
+namespace {
+
+namespace act = amr_wind::actuator;
+
+//! Polar in the text format with non-uniform spacing of the angle of attack
+std::stringstream generate_airfoil(const int num_entries)
+{
+    std::stringstream ss;
+    ss << num_entries << std::endl;
+    for (int i = 0; i < num_entries; ++i) {
+        // Cluster the angles of attack around zero like typical polars
+        const amrex::Real xi = -1.0 + 2.0 * i / (num_entries - 1);
+        const amrex::Real aoa = 180.0 * xi * xi * xi;
+        const amrex::Real aoa_rad = amr_wind::utils::radians(aoa);
+        ss << aoa << " " << std::sin(2.0 * aoa_rad) << " "
+           << 1.0 - std::cos(2.0 * aoa_rad) << " " << -0.1 * std::sin(aoa_rad)
+           << std::endl;
+    }
+    return ss;
+}
+
+template <typename Func>
+amrex::Real time_loop(const int num_repeats, Func&& func)
+{
+    const auto t0 = amrex::ParallelDescriptor::second();
+    for (int n = 0; n < num_repeats; ++n) {
+        func();
+    }
+    return (amrex::ParallelDescriptor::second() - t0) / num_repeats;
+}
+
+void print_timing(
+    const std::string& name, const amrex::Real time, const amrex::Real ref)
+{
+    amrex::Print() << std::setw(20) << name << std::setw(16) << time
+                   << std::setw(12) << ref / time << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+#ifdef AMREX_USE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    amr_wind::io::print_banner(MPI_COMM_WORLD, std::cout);
+
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp("amrex");
+        // Set the defaults so that we throw an exception instead of attempting
+        // to generate backtrace files. However, if the user has explicitly set
+        // these options in their input files respect those settings.
+        if (!pp.contains("throw_exception")) pp.add("throw_exception", 1);
+        if (!pp.contains("signal_handling")) pp.add("signal_handling", 0);
+    });
+
+    {
+        BL_PROFILE("airfoil-bench::main");
+        amrex::ParmParse pp("airfoil_bench");
+        int num_entries = 500;
+        int num_lookups = 100000;
+        int num_repeats = 10;
+        pp.query("num_entries", num_entries);
+        pp.query("num_lookups", num_lookups);
+        pp.query("num_repeats", num_repeats);
+        AMREX_ALWAYS_ASSERT(num_entries > 1);
+        AMREX_ALWAYS_ASSERT(num_lookups > 0);
+        AMREX_ALWAYS_ASSERT(num_repeats > 0);
+
+        auto ss = generate_airfoil(num_entries);
+        auto af = act::AirfoilLoader::load_text_file(ss);
+        const auto& aoa_tab = af->aoa();
+        const auto& polar_tab = af->polars();
+
+        act::RealList aoa(num_lookups);
+        for (auto& val : aoa) {
+            val = amr_wind::utils::pi() * (2.0 * amrex::Random() - 1.0);
+        }
+
+        // Reference: bisection search for every lookup
+        act::VecList ref_polars(num_lookups);
+        const amrex::Real t_ref = time_loop(num_repeats, [&]() {
+            for (int i = 0; i < num_lookups; ++i) {
+                ref_polars[i] = amr_wind::interp::linear(
+                    aoa_tab, polar_tab, aoa[i]);
+            }
+        });
+
+        // Binned lookup
+        act::VecList binned_polars(num_lookups);
+        const amrex::Real t_binned = time_loop(num_repeats, [&]() {
+            amrex::Real cl, cd, cm;
+            for (int i = 0; i < num_lookups; ++i) {
+                (*af)(aoa[i], cl, cd, cm);
+                binned_polars[i] = amr_wind::vs::Vector(cl, cd, cm);
+            }
+        });
+
+        amrex::Real max_diff = 0.0;
+        for (int i = 0; i < num_lookups; ++i) {
+            const auto diff = binned_polars[i] - ref_polars[i];
+            max_diff = amrex::max(
+                max_diff, amrex::max(
+                              std::abs(diff.x()), std::abs(diff.y()),
+                              std::abs(diff.z())));
+        }
+
+        amrex::Print() << "Airfoil lookup benchmark: " << num_entries
+                       << " entries, " << num_lookups << " lookups, "
+                       << num_repeats << " repeats, " << af->num_bins()
+                       << " bins" << std::endl;
+        amrex::Print() << std::setw(20) << "method" << std::setw(16)
+                       << "time (s)" << std::setw(12) << "speedup"
+                       << std::endl;
+        print_timing("bisection", t_ref, t_ref);
+        print_timing("binned", t_binned, t_ref);
+        amrex::Print() << "Maximum difference from bisection: " << max_diff
+                       << std::endl;
+    }
+
+    amrex::Finalize();
+
+#ifdef AMREX_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
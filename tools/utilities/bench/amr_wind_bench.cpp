@@ -0,0 +1,653 @@
+/** \file amr_wind_bench.cpp
+ *
+ *  Benchmark driver for the AMR-Wind timestep. The driver runs a case for a
+ *  fixed number of timesteps with plot and checkpoint output disabled, and
+ *  writes a JSON report with the time per step, the time spent in the major
+ *  phases of the timestep (see amr_wind::PerfTimers), the throughput in cells
+ *  per second, and the memory high-water marks. The report can optionally be
+ *  compared against a baseline report from a previous run.
+ *
+ *  Usage: `amr_wind_bench <input file> [overrides]`
+ *
+ *  Canonical cases are available in the `cases` directory next to this file.
+ *
+ *  Inputs (prefix `bench`):
+ *
+ *  - `name`: case name used in the report (default: input file name)
+ *  - `size`: `small` (default), `medium` or `large`; refines the base mesh
+ *     by a factor of 1, 2, or 4 in each direction
+ *  - `refine_factor`: refinement factor, overrides `size`
+ *  - `num_steps`: number of timesteps measured (default 10)
+ *  - `warmup_steps`: timesteps excluded from the statistics (default 2)
+ *  - `output_file`: JSON report (default: `bench_<name>_<size>.json`)
+ *  - `baseline_file`: JSON report to compare against (optional)
+ *  - `tolerance`: relative slowdown allowed before a metric is flagged as a
+ *     regression (default 0.1)
+ *  - `fail_on_regression`: return a non-zero exit code if a regression is
+ *     detected (default true)
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "amr-wind/incflo.H"
+#include "amr-wind/AMRWindVersion.H"
+#include "amr-wind/utilities/PerfTimers.H"
+#include "amr-wind/utilities/console_io.H"
+
+#include "AMReX.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_FileSystem.H"
+
+namespace {
+
+//! Benchmark configuration
+struct BenchConfig
+{
+    std::string input_file;
+    std::string name;
+    std::string size{"small"};
+    int refine_factor{1};
+    int num_steps{10};
+    int warmup_steps{2};
+    std::string output_file;
+    std::string baseline_file;
+    double tolerance{0.1};
+    bool fail_on_regression{true};
+};
+
+//! Summary statistics of a sample
+struct Stats
+{
+    double mean{0.0};
+    double min{0.0};
+    double max{0.0};
+    double stddev{0.0};
+    double total{0.0};
+};
+
+Stats compute_stats(const amrex::Vector<double>& vals)
+{
+    Stats stats;
+    if (vals.empty()) {
+        return stats;
+    }
+    const auto nvals = static_cast<double>(vals.size());
+    stats.min = *std::min_element(vals.begin(), vals.end());
+    stats.max = *std::max_element(vals.begin(), vals.end());
+    for (const auto val : vals) {
+        stats.total += val;
+    }
+    stats.mean = stats.total / nvals;
+    double var = 0.0;
+    for (const auto val : vals) {
+        var += (val - stats.mean) * (val - stats.mean);
+    }
+    stats.stddev = std::sqrt(var / nvals);
+    return stats;
+}
+
+/** Read the benchmark inputs and override the case inputs accordingly
+ *
+ *  Must be called before the incflo instance is created.
+ */
+BenchConfig configure(const std::string& input_file)
+{
+    BenchConfig cfg;
+    cfg.input_file = input_file;
+    {
+        auto fname = input_file.substr(input_file.find_last_of('/') + 1);
+        cfg.name = fname.substr(0, fname.find_last_of('.'));
+    }
+
+    amrex::ParmParse pp("bench");
+    pp.query("name", cfg.name);
+    pp.query("size", cfg.size);
+    if (cfg.size == "small") {
+        cfg.refine_factor = 1;
+    } else if (cfg.size == "medium") {
+        cfg.refine_factor = 2;
+    } else if (cfg.size == "large") {
+        cfg.refine_factor = 4;
+    } else {
+        amrex::Abort(
+            "amr_wind_bench: invalid bench.size = " + cfg.size +
+            ". Valid options are: small, medium, large");
+    }
+    if (pp.contains("refine_factor")) {
+        pp.get("refine_factor", cfg.refine_factor);
+        cfg.size = "x" + std::to_string(cfg.refine_factor);
+    }
+    pp.query("num_steps", cfg.num_steps);
+    pp.query("warmup_steps", cfg.warmup_steps);
+    cfg.output_file = "bench_" + cfg.name + "_" + cfg.size + ".json";
+    pp.query("output_file", cfg.output_file);
+    pp.query("baseline_file", cfg.baseline_file);
+    pp.query("tolerance", cfg.tolerance);
+    pp.query("fail_on_regression", cfg.fail_on_regression);
+    AMREX_ALWAYS_ASSERT(cfg.refine_factor > 0);
+    AMREX_ALWAYS_ASSERT(cfg.num_steps > 0);
+    AMREX_ALWAYS_ASSERT(cfg.warmup_steps >= 0);
+
+    // Scale the base mesh
+    if (cfg.refine_factor > 1) {
+        amrex::ParmParse ppamr("amr");
+        amrex::Vector<int> ncell;
+        ppamr.getarr("n_cell", ncell);
+        for (auto& nc : ncell) {
+            nc *= cfg.refine_factor;
+        }
+        ppamr.addarr("n_cell", ncell);
+    }
+
+    // Run a fixed number of steps without any plot or checkpoint output
+    {
+        amrex::ParmParse pptime("time");
+        pptime.add("stop_time", -1.0);
+        pptime.add("max_step", cfg.warmup_steps + cfg.num_steps);
+        pptime.add("plot_interval", -1);
+        pptime.add("checkpoint_interval", -1);
+    }
+    {
+        amrex::ParmParse ppperf("perf");
+        ppperf.add("timers", true);
+    }
+    return cfg;
+}
+
+//! Results of a benchmark run (reduced across all ranks)
+struct BenchResults
+{
+    double init_time{0.0};
+    amrex::Long num_cells{0};
+    Stats step_time;
+    double cells_per_second{0.0};
+    amrex::Long resident_hwm_max{0};
+    amrex::Long resident_hwm_total{0};
+    amrex::Long fab_hwm_max{0};
+    amrex::Vector<std::string> phase_names;
+    amrex::Vector<Stats> phase_stats;
+};
+
+BenchResults collect_results(
+    const BenchConfig& cfg, const amr_wind::PerfTimers& perf, double init_time)
+{
+    BenchResults res;
+
+    // Discard the warmup steps
+    const auto& history = perf.history();
+    const int nhist = static_cast<int>(history.size());
+    const int nstart = std::min(cfg.warmup_steps, nhist);
+    const int nsteps = nhist - nstart;
+    if (nsteps < 1) {
+        amrex::Abort("amr_wind_bench: no timesteps were measured");
+    }
+
+    // Phases are registered in the same order on all ranks
+    res.phase_names = perf.phase_names();
+    const int nphases = static_cast<int>(res.phase_names.size());
+    {
+        int nmin = nphases;
+        int nmax = nphases;
+        amrex::ParallelDescriptor::ReduceIntMin(nmin);
+        amrex::ParallelDescriptor::ReduceIntMax(nmax);
+        AMREX_ALWAYS_ASSERT(nmin == nmax);
+    }
+
+    // Use the slowest rank for every step and phase
+    const int nvals = nsteps * (nphases + 1);
+    amrex::Vector<double> times(nvals, 0.0);
+    for (int n = 0; n < nsteps; ++n) {
+        const auto& rec = history[nstart + n];
+        times[n * (nphases + 1)] = rec.wall_time;
+        for (int ip = 0; ip < static_cast<int>(rec.phase_times.size()); ++ip) {
+            times[n * (nphases + 1) + ip + 1] = rec.phase_times[ip];
+        }
+        res.num_cells = amrex::max(res.num_cells, rec.num_cells);
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(times.data(), nvals);
+
+    amrex::Vector<double> vals(nsteps);
+    for (int n = 0; n < nsteps; ++n) {
+        vals[n] = times[n * (nphases + 1)];
+    }
+    res.step_time = compute_stats(vals);
+    for (int ip = 0; ip < nphases; ++ip) {
+        for (int n = 0; n < nsteps; ++n) {
+            vals[n] = times[n * (nphases + 1) + ip + 1];
+        }
+        res.phase_stats.push_back(compute_stats(vals));
+    }
+
+    double cell_steps = 0.0;
+    for (int n = 0; n < nsteps; ++n) {
+        cell_steps += static_cast<double>(history[nstart + n].num_cells);
+    }
+    res.cells_per_second =
+        (res.step_time.total > 0.0) ? cell_steps / res.step_time.total : 0.0;
+
+    // Reduce to all ranks so that the baseline comparison, and with it the
+    // exit code, is identical everywhere
+    res.init_time = init_time;
+    amrex::ParallelDescriptor::ReduceRealMax(res.init_time);
+
+    res.resident_hwm_max = amr_wind::perf::resident_memory_hwm();
+    res.resident_hwm_total = res.resident_hwm_max;
+    res.fab_hwm_max = amr_wind::perf::fab_memory_hwm();
+    amrex::ParallelDescriptor::ReduceLongMax(res.resident_hwm_max);
+    amrex::ParallelDescriptor::ReduceLongSum(res.resident_hwm_total);
+    amrex::ParallelDescriptor::ReduceLongMax(res.fab_hwm_max);
+    return res;
+}
+
+/** Minimal reader for the JSON reports written by this driver
+ *
+ *  Numeric values within nested objects are returned with keys formed by
+ *  joining the names of the enclosing objects with a `.`, e.g.,
+ *  `phases.advance.mean`. Strings, booleans and arrays are skipped.
+ */
+class JsonReader
+{
+public:
+    explicit JsonReader(std::string text) : m_text(std::move(text)) {}
+
+    std::map<std::string, double> parse()
+    {
+        skip_ws();
+        parse_value("");
+        return m_values;
+    }
+
+private:
+    [[noreturn]] void error() const
+    {
+        amrex::Abort(
+            "amr_wind_bench: invalid JSON at position " +
+            std::to_string(m_pos));
+        std::exit(1);
+    }
+
+    void skip_ws()
+    {
+        while ((m_pos < m_text.size()) &&
+               (std::isspace(static_cast<unsigned char>(m_text[m_pos])) !=
+                0)) {
+            ++m_pos;
+        }
+    }
+
+    void expect(const char c)
+    {
+        skip_ws();
+        if ((m_pos >= m_text.size()) || (m_text[m_pos] != c)) {
+            error();
+        }
+        ++m_pos;
+    }
+
+    std::string parse_string()
+    {
+        expect('"');
+        std::string str;
+        while ((m_pos < m_text.size()) && (m_text[m_pos] != '"')) {
+            if (m_text[m_pos] == '\\') {
+                ++m_pos;
+            }
+            str += m_text[m_pos++];
+        }
+        expect('"');
+        return str;
+    }
+
+    void parse_object(const std::string& prefix)
+    {
+        expect('{');
+        skip_ws();
+        if (m_text[m_pos] == '}') {
+            ++m_pos;
+            return;
+        }
+        while (true) {
+            skip_ws();
+            const auto key = parse_string();
+            expect(':');
+            skip_ws();
+            parse_value(prefix.empty() ? key : (prefix + "." + key));
+            skip_ws();
+            if (m_text[m_pos] == ',') {
+                ++m_pos;
+            } else {
+                expect('}');
+                return;
+            }
+        }
+    }
+
+    void parse_array()
+    {
+        expect('[');
+        skip_ws();
+        if (m_text[m_pos] == ']') {
+            ++m_pos;
+            return;
+        }
+        while (true) {
+            skip_ws();
+            parse_value("");
+            skip_ws();
+            if (m_text[m_pos] == ',') {
+                ++m_pos;
+            } else {
+                expect(']');
+                return;
+            }
+        }
+    }
+
+    void parse_value(const std::string& key)
+    {
+        if (m_pos >= m_text.size()) {
+            error();
+        }
+        const char c = m_text[m_pos];
+        if (c == '{') {
+            parse_object(key);
+        } else if (c == '[') {
+            parse_array();
+        } else if (c == '"') {
+            parse_string();
+        } else if (std::isalpha(static_cast<unsigned char>(c)) != 0) {
+            // true, false, or null
+            while ((m_pos < m_text.size()) &&
+                   (std::isalpha(static_cast<unsigned char>(m_text[m_pos])) !=
+                    0)) {
+                ++m_pos;
+            }
+        } else {
+            size_t len = 0;
+            const double val = std::stod(m_text.substr(m_pos), &len);
+            if (len == 0) {
+                error();
+            }
+            m_pos += len;
+            if (!key.empty()) {
+                m_values[key] = val;
+            }
+        }
+    }
+
+    const std::string m_text;
+    size_t m_pos{0};
+    std::map<std::string, double> m_values;
+};
+
+//! Comparison of the current results against a baseline
+struct Comparison
+{
+    struct Entry
+    {
+        std::string metric;
+        double baseline;
+        double current;
+        bool higher_is_better;
+        bool regression;
+    };
+
+    amrex::Vector<Entry> entries;
+
+    int num_regressions() const
+    {
+        return static_cast<int>(std::count_if(
+            entries.begin(), entries.end(),
+            [](const Entry& e) { return e.regression; }));
+    }
+};
+
+Comparison compare_baseline(
+    const BenchConfig& cfg, const std::map<std::string, double>& current)
+{
+    std::ifstream ifh(cfg.baseline_file);
+    if (!ifh.good()) {
+        amrex::Abort(
+            "amr_wind_bench: cannot open baseline file " + cfg.baseline_file);
+    }
+    std::stringstream buf;
+    buf << ifh.rdbuf();
+    const auto baseline = JsonReader(buf.str()).parse();
+
+    Comparison cmp;
+    const auto add_entry = [&](const std::string& metric,
+                               const bool higher_is_better) {
+        const auto bfound = baseline.find(metric);
+        const auto cfound = current.find(metric);
+        if ((bfound == baseline.end()) || (cfound == current.end()) ||
+            (bfound->second <= 0.0)) {
+            return;
+        }
+        const double ratio = cfound->second / bfound->second;
+        const bool regression = higher_is_better
+                                    ? (ratio * (1.0 + cfg.tolerance) < 1.0)
+                                    : (ratio > 1.0 + cfg.tolerance);
+        cmp.entries.push_back(
+            {metric, bfound->second, cfound->second, higher_is_better,
+             regression});
+    };
+
+    add_entry("step_time.mean", false);
+    add_entry("cells_per_second", true);
+    add_entry("memory.resident_hwm_bytes_max", false);
+    for (const auto& kv : current) {
+        const auto& key = kv.first;
+        const std::string suffix = ".mean";
+        if ((key.rfind("phases.", 0) == 0) && (key.size() > suffix.size()) &&
+            (key.compare(key.size() - suffix.size(), suffix.size(), suffix) ==
+             0)) {
+            add_entry(key, false);
+        }
+    }
+    return cmp;
+}
+
+void write_stats(std::ostream& os, const Stats& stats, const std::string& ind)
+{
+    os << "{\n"
+       << ind << "  \"mean\": " << stats.mean << ",\n"
+       << ind << "  \"min\": " << stats.min << ",\n"
+       << ind << "  \"max\": " << stats.max << ",\n"
+       << ind << "  \"stddev\": " << stats.stddev << ",\n"
+       << ind << "  \"total\": " << stats.total << "\n"
+       << ind << "}";
+}
+
+std::string json_report(
+    const BenchConfig& cfg,
+    const BenchResults& res,
+    const Comparison* cmp = nullptr)
+{
+    std::ostringstream os;
+    os << std::setprecision(12);
+    os << "{\n"
+       << "  \"name\": \"" << cfg.name << "\",\n"
+       << "  \"size\": \"" << cfg.size << "\",\n"
+       << "  \"input_file\": \"" << cfg.input_file << "\",\n"
+       << "  \"amr_wind_version\": \"" << amr_wind::version::amr_wind_version
+       << "\",\n"
+       << "  \"amr_wind_git_sha\": \"" << amr_wind::version::amr_wind_git_sha
+       << "\",\n"
+       << "  \"num_ranks\": " << amrex::ParallelDescriptor::NProcs() << ",\n"
+#ifdef AMREX_USE_GPU
+       << "  \"gpu\": true,\n"
+#else
+       << "  \"gpu\": false,\n"
+#endif
+       << "  \"refine_factor\": " << cfg.refine_factor << ",\n"
+       << "  \"num_steps\": " << cfg.num_steps << ",\n"
+       << "  \"warmup_steps\": " << cfg.warmup_steps << ",\n"
+       << "  \"num_cells\": " << res.num_cells << ",\n"
+       << "  \"init_time\": " << res.init_time << ",\n"
+       << "  \"step_time\": ";
+    write_stats(os, res.step_time, "  ");
+    os << ",\n"
+       << "  \"cells_per_second\": " << res.cells_per_second << ",\n"
+       << "  \"memory\": {\n"
+       << "    \"resident_hwm_bytes_max\": " << res.resident_hwm_max << ",\n"
+       << "    \"resident_hwm_bytes_total\": " << res.resident_hwm_total
+       << ",\n"
+       << "    \"fab_hwm_bytes_max\": " << res.fab_hwm_max << "\n"
+       << "  },\n"
+       << "  \"phases\": {";
+    const int nphases = static_cast<int>(res.phase_names.size());
+    for (int ip = 0; ip < nphases; ++ip) {
+        os << ((ip > 0) ? "," : "") << "\n    \"" << res.phase_names[ip]
+           << "\": ";
+        write_stats(os, res.phase_stats[ip], "    ");
+    }
+    os << "\n  }";
+
+    if (cmp != nullptr) {
+        os << ",\n  \"comparison\": {\n"
+           << "    \"baseline_file\": \"" << cfg.baseline_file << "\",\n"
+           << "    \"tolerance\": " << cfg.tolerance << ",\n"
+           << "    \"num_regressions\": " << cmp->num_regressions() << ",\n"
+           << "    \"metrics\": {";
+        for (int i = 0; i < static_cast<int>(cmp->entries.size()); ++i) {
+            const auto& e = cmp->entries[i];
+            os << ((i > 0) ? "," : "") << "\n      \"" << e.metric << "\": {"
+               << "\"baseline\": " << e.baseline
+               << ", \"current\": " << e.current
+               << ", \"ratio\": " << e.current / e.baseline
+               << ", \"regression\": " << (e.regression ? "true" : "false")
+               << "}";
+        }
+        os << "\n    }\n  }";
+    }
+    os << "\n}\n";
+    return os.str();
+}
+
+void print_summary(const BenchConfig& cfg, const BenchResults& res)
+{
+    amrex::Print() << "\nBenchmark: " << cfg.name << " (" << cfg.size << ", "
+                   << res.num_cells << " cells, "
+                   << amrex::ParallelDescriptor::NProcs() << " ranks)"
+                   << std::endl
+                   << "  Time per step: " << res.step_time.mean << " s (min "
+                   << res.step_time.min << ", max " << res.step_time.max
+                   << ")" << std::endl
+                   << "  Cells per second: " << res.cells_per_second
+                   << std::endl
+                   << "  Resident memory high-water (max per rank): "
+                   << static_cast<double>(res.resident_hwm_max) /
+                          (1024.0 * 1024.0)
+                   << " MB" << std::endl;
+    for (int ip = 0; ip < static_cast<int>(res.phase_names.size()); ++ip) {
+        const auto& stats = res.phase_stats[ip];
+        amrex::Print() << "  " << std::setw(20) << std::left
+                       << res.phase_names[ip] << std::right << std::setw(14)
+                       << stats.mean << " s/step" << std::setw(10)
+                       << std::setprecision(3)
+                       << 100.0 * stats.mean /
+                              amrex::max(res.step_time.mean, 1.0e-30)
+                       << " %" << std::setprecision(6) << std::endl;
+    }
+}
+
+void print_comparison(const BenchConfig& cfg, const Comparison& cmp)
+{
+    amrex::Print() << "\nComparison against baseline " << cfg.baseline_file
+                   << " (tolerance " << 100.0 * cfg.tolerance << " %)"
+                   << std::endl;
+    for (const auto& e : cmp.entries) {
+        amrex::Print() << "  " << std::setw(36) << std::left << e.metric
+                       << std::right << std::setw(14) << e.baseline
+                       << std::setw(14) << e.current << std::setw(10)
+                       << std::setprecision(3) << e.current / e.baseline
+                       << std::setprecision(6)
+                       << (e.regression ? "  REGRESSION" : "") << std::endl;
+    }
+    amrex::Print() << "Number of regressions: " << cmp.num_regressions()
+                   << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+#ifdef AMREX_USE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    if ((argc < 2) || !amrex::FileSystem::Exists(std::string(argv[1]))) {
+        amr_wind::io::print_error(
+            MPI_COMM_WORLD,
+            "Usage: amr_wind_bench <input file> [overrides]. Exiting!!");
+#ifdef AMREX_USE_MPI
+        MPI_Finalize();
+#endif
+        return 1;
+    }
+
+    amr_wind::io::print_banner(MPI_COMM_WORLD, std::cout);
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp("amrex");
+        // Set the defaults so that we throw an exception instead of attempting
+        // to generate backtrace files. However, if the user has explicitly set
+        // these options in their input files respect those settings.
+        if (!pp.contains("throw_exception")) pp.add("throw_exception", 1);
+        if (!pp.contains("signal_handling")) pp.add("signal_handling", 0);
+    });
+
+    int num_regressions = 0;
+    bool fail_on_regression = true;
+    {
+        BL_PROFILE("amr-wind-bench::main");
+        const auto cfg = configure(std::string(argv[1]));
+        fail_on_regression = cfg.fail_on_regression;
+
+        const double start_time = amrex::ParallelDescriptor::second();
+        incflo my_incflo;
+        my_incflo.InitData();
+        const double init_time =
+            amrex::ParallelDescriptor::second() - start_time;
+
+        my_incflo.Evolve();
+
+        const auto res =
+            collect_results(cfg, my_incflo.sim().perf_timers(), init_time);
+        print_summary(cfg, res);
+
+        auto report = json_report(cfg, res);
+        if (!cfg.baseline_file.empty()) {
+            const auto cmp = compare_baseline(cfg, JsonReader(report).parse());
+            print_comparison(cfg, cmp);
+            num_regressions = cmp.num_regressions();
+            report = json_report(cfg, res, &cmp);
+        }
+
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            std::ofstream ofh(cfg.output_file);
+            ofh << report;
+            if (!ofh.good()) {
+                amrex::Abort(
+                    "amr_wind_bench: error writing " + cfg.output_file);
+            }
+        }
+        amrex::Print() << "Benchmark results written to " << cfg.output_file
+                       << std::endl;
+    }
+
+    amrex::Finalize();
+#ifdef AMREX_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return ((num_regressions > 0) && fail_on_regression) ? 2 : 0;
+}
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Run the AMR-Wind benchmark cases
+
+Runs ``amr_wind_bench`` for each case and size and merges the JSON reports
+into a single summary file. If a baseline directory containing the reports
+from a previous run is given, each case is compared against its baseline.
+"""
+
+import argparse
+import json
+import pathlib
+import shlex
+import subprocess
+import sys
+
+
+def main():
+    """Run the benchmarks"""
+    here = pathlib.Path(__file__).resolve().parent
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "-e", "--exe", default="amr_wind_bench", help="Benchmark executable"
+    )
+    parser.add_argument(
+        "-c",
+        "--cases",
+        nargs="+",
+        default=["abl", "channel", "actuator_farm", "dam_break"],
+        help="Cases to run",
+    )
+    parser.add_argument(
+        "-s",
+        "--sizes",
+        nargs="+",
+        default=["small"],
+        choices=["small", "medium", "large"],
+        help="Problem sizes",
+    )
+    parser.add_argument(
+        "-n", "--num-steps", type=int, default=10, help="Measured timesteps"
+    )
+    parser.add_argument(
+        "--launcher",
+        default="",
+        help="MPI launcher prefix, e.g., 'mpiexec -np 4'",
+    )
+    parser.add_argument(
+        "--case-dir",
+        default=str(here / "cases"),
+        help="Directory containing the case input files",
+    )
+    parser.add_argument(
+        "-o", "--output-dir", default="bench_results", help="Output directory"
+    )
+    parser.add_argument(
+        "-b", "--baseline-dir", help="Directory with the baseline reports"
+    )
+    parser.add_argument(
+        "-t", "--tolerance", type=float, default=0.1, help="Regression tolerance"
+    )
+    args = parser.parse_args()
+
+    outdir = pathlib.Path(args.output_dir).resolve()
+    outdir.mkdir(parents=True, exist_ok=True)
+    casedir = pathlib.Path(args.case_dir).resolve()
+
+    summary = []
+    status = 0
+    for case in args.cases:
+        for size in args.sizes:
+            report = outdir / f"bench_{case}_{size}.json"
+            cmd = shlex.split(args.launcher) + [
+                args.exe,
+                str(casedir / f"{case}.inp"),
+                f"bench.name={case}",
+                f"bench.size={size}",
+                f"bench.num_steps={args.num_steps}",
+                f"bench.output_file={report}",
+                f"bench.tolerance={args.tolerance}",
+            ]
+            if args.baseline_dir:
+                baseline = pathlib.Path(args.baseline_dir) / report.name
+                if baseline.exists():
+                    cmd.append(f"bench.baseline_file={baseline.resolve()}")
+                else:
+                    print(f"No baseline for {case} ({size}): {baseline}")
+
+            print(" ".join(cmd), flush=True)
+            ret = subprocess.run(cmd, cwd=outdir, check=False).returncode
+            if ret != 0:
+                status = 1
+                print(f"{case} ({size}) failed with exit code {ret}")
+            if report.exists():
+                with open(report, "r", encoding="utf-8") as fh:
+                    summary.append(json.load(fh))
+
+    with open(outdir / "summary.json", "w", encoding="utf-8") as fh:
+        json.dump(summary, fh, indent=2)
+
+    print(f"\n{'case':<16s}{'size':<8s}{'cells':>12s}{'s/step':>12s}"
+          f"{'cells/s':>14s}")
+    for res in summary:
+        print(
+            f"{res['name']:<16s}{res['size']:<8s}{res['num_cells']:>12d}"
+            f"{res['step_time']['mean']:>12.4g}"
+            f"{res['cells_per_second']:>14.4g}"
+        )
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,274 @@
+/** \file bndry_compare.cpp
+ *
+ *  Compare two sets of ABL boundary planes, e.g., uncompressed planes from a
+ *  precursor run and planes written with `ABL.bndry_compression`, and report
+ *  the error of the inflow data for every variable and boundary face.
+ *
+ *  Inputs (prefix `bndry_compare`):
+ *
+ *  - `reference_file`: boundary plane file (or directory) used as reference
+ *  - `test_file`: boundary plane file (or directory) to compare
+ *  - `format`: `native` (default) or `netcdf`
+ *  - `var_names`: variables to compare (default: `velocity temperature`)
+ */
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+#include "amr-wind/utilities/console_io.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+
+#include "AMReX.H"
+#include "AMReX_MultiFab.H"
+#include "AMReX_Orientation.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_PlotFileUtil.H"
+#include "AMReX_VisMF.H"
+
+namespace {
+
+const amrex::Vector<std::string> plane_names{
+    {"xlo", "ylo", "zlo", "xhi", "yhi", "zhi"}};
+
+//! Error statistics for one variable on one boundary face
+struct ErrorStats
+{
+    amrex::Real max_err{0.0};
+    amrex::Real sum_sq_err{0.0};
+    amrex::Real max_ref{0.0};
+    amrex::Long npts{0};
+
+    void print(const std::string& var, const std::string& plane) const
+    {
+        const amrex::Real rms =
+            (npts > 0) ? std::sqrt(sum_sq_err / static_cast<amrex::Real>(npts))
+                       : 0.0;
+        const amrex::Real rel = (max_ref > 0.0) ? max_err / max_ref : 0.0;
+        amrex::Print() << std::setw(14) << var << std::setw(6) << plane
+                       << std::setw(16) << max_err << std::setw(16) << rms
+                       << std::setw(16) << rel << std::endl;
+    }
+};
+
+void print_table_header()
+{
+    amrex::Print() << std::setw(14) << "variable" << std::setw(6) << "face"
+                   << std::setw(16) << "max abs err" << std::setw(16)
+                   << "rms err" << std::setw(16) << "max rel err" << std::endl;
+}
+
+//! Read the time steps listed in the time file of a native boundary file
+amrex::Vector<int> native_time_steps(const std::string& bndry_file)
+{
+    amrex::Vector<int> steps;
+    int nsteps = 0;
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ifstream time_file(bndry_file + "/time.dat");
+        if (!time_file.good()) {
+            amrex::Abort("Cannot find time file in: " + bndry_file);
+        }
+        int step;
+        amrex::Real time;
+        while (time_file >> step >> time) {
+            steps.push_back(step);
+        }
+        nsteps = static_cast<int>(steps.size());
+    }
+    amrex::ParallelDescriptor::Bcast(
+        &nsteps, 1, amrex::ParallelDescriptor::IOProcessorNumber());
+    steps.resize(nsteps);
+    amrex::ParallelDescriptor::Bcast(
+        steps.data(), nsteps, amrex::ParallelDescriptor::IOProcessorNumber());
+    return steps;
+}
+
+void compare_native(
+    const std::string& ref_file,
+    const std::string& test_file,
+    const amrex::Vector<std::string>& var_names)
+{
+    BL_PROFILE("bndry-compare::compare_native");
+    const auto steps = native_time_steps(ref_file);
+    const int lev = 0;
+
+    print_table_header();
+    for (const auto& var : var_names) {
+        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+            const auto ori = oit();
+            ErrorStats stats;
+            bool found = false;
+
+            for (const int step : steps) {
+                const auto face_name = [&](const std::string& fname) {
+                    const std::string chkname =
+                        fname + amrex::Concatenate("/bndry_output", step);
+                    return amrex::Concatenate(
+                        amrex::MultiFabFileFullPrefix(
+                            lev, chkname, "Level_", var) +
+                            '_',
+                        ori, 1);
+                };
+                const auto ref_face = face_name(ref_file);
+                if (!amrex::VisMF::Exist(ref_face)) {
+                    continue;
+                }
+                const auto test_face = face_name(test_file);
+                if (!amrex::VisMF::Exist(test_face)) {
+                    amrex::Abort("Missing boundary data: " + test_face);
+                }
+                found = true;
+
+                amrex::MultiFab ref;
+                amrex::VisMF::Read(ref, ref_face);
+                amrex::MultiFab test_in;
+                amrex::VisMF::Read(test_in, test_face);
+                amrex::MultiFab diff(
+                    ref.boxArray(), ref.DistributionMap(), ref.nComp(), 0);
+                diff.ParallelCopy(test_in);
+                amrex::MultiFab::Subtract(diff, ref, 0, 0, ref.nComp(), 0);
+
+                for (int n = 0; n < ref.nComp(); ++n) {
+                    const amrex::Real l2 = diff.norm2(n);
+                    stats.max_err = amrex::max(stats.max_err, diff.norm0(n));
+                    stats.max_ref = amrex::max(stats.max_ref, ref.norm0(n));
+                    stats.sum_sq_err += l2 * l2;
+                    stats.npts += ref.boxArray().numPts();
+                }
+            }
+
+            if (found) {
+                stats.print(var, plane_names[ori]);
+            }
+        }
+    }
+}
+
+#ifdef AMR_WIND_USE_NETCDF
+void compare_netcdf(
+    const std::string& ref_file,
+    const std::string& test_file,
+    const amrex::Vector<std::string>& var_names)
+{
+    BL_PROFILE("bndry-compare::compare_netcdf");
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    auto ref_ncf = ncutils::NCFile::open(ref_file, NC_NOWRITE);
+    auto test_ncf = ncutils::NCFile::open(test_file, NC_NOWRITE);
+
+    print_table_header();
+    for (const auto& var : var_names) {
+        for (const auto& plane : plane_names) {
+            if (!ref_ncf.has_group(plane)) {
+                continue;
+            }
+            auto ref_grp = ref_ncf.group(plane);
+            auto test_grp = test_ncf.group(plane);
+
+            ErrorStats stats;
+            bool found = false;
+            const int nlevels = ref_grp.num_groups();
+            for (int lev = 0; lev < nlevels; ++lev) {
+                const std::string lname = "level_" + std::to_string(lev);
+                auto ref_lev = ref_grp.group(lname);
+                if (!ref_lev.has_var(var)) {
+                    continue;
+                }
+                found = true;
+                auto ref_var = ref_lev.var(var);
+                auto test_var = test_grp.group(lname).var(var);
+
+                const auto shape = ref_var.shape();
+                if (shape != test_var.shape()) {
+                    amrex::Abort(
+                        "Boundary data shapes do not match for " + var +
+                        " on " + plane);
+                }
+                size_t npts = 1;
+                for (const auto len : shape) {
+                    npts *= len;
+                }
+
+                std::vector<double> ref_data(npts);
+                std::vector<double> test_data(npts);
+                ref_var.get(ref_data.data());
+                test_var.get(test_data.data());
+                for (size_t i = 0; i < npts; ++i) {
+                    const double err = std::abs(test_data[i] - ref_data[i]);
+                    stats.max_err = amrex::max(stats.max_err, err);
+                    stats.max_ref =
+                        amrex::max(stats.max_ref, std::abs(ref_data[i]));
+                    stats.sum_sq_err += err * err;
+                }
+                stats.npts += static_cast<amrex::Long>(npts);
+            }
+
+            if (found) {
+                stats.print(var, plane);
+            }
+        }
+    }
+}
+#endif
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+#ifdef AMREX_USE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    amr_wind::io::print_banner(MPI_COMM_WORLD, std::cout);
+
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp("amrex");
+        // Set the defaults so that we throw an exception instead of attempting
+        // to generate backtrace files. However, if the user has explicitly set
+        // these options in their input files respect those settings.
+        if (!pp.contains("throw_exception")) pp.add("throw_exception", 1);
+        if (!pp.contains("signal_handling")) pp.add("signal_handling", 0);
+    });
+
+    {
+        BL_PROFILE("bndry-compare::main");
+        amrex::ParmParse pp("bndry_compare");
+        std::string ref_file;
+        std::string test_file;
+        pp.get("reference_file", ref_file);
+        pp.get("test_file", test_file);
+        std::string format{"native"};
+        pp.query("format", format);
+        amrex::Vector<std::string> var_names{"velocity", "temperature"};
+        pp.queryarr("var_names", var_names);
+
+        amrex::Print() << "Comparing boundary data in " << test_file
+                       << " against " << ref_file << std::endl;
+        if (format == "native") {
+            compare_native(ref_file, test_file, var_names);
+        } else if (format == "netcdf") {
+#ifdef AMR_WIND_USE_NETCDF
+            compare_netcdf(ref_file, test_file, var_names);
+#else
+            amrex::Abort(
+                "bndry_compare: netcdf format requires AMR-Wind to be built "
+                "with NetCDF support");
+#endif
+        } else {
+            amrex::Abort(
+                "bndry_compare: invalid format " + format +
+                ". Valid options are: native, netcdf");
+        }
+    }
+
+    amrex::Finalize();
+
+#ifdef AMREX_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+/** \file hos_convert.cpp
+ *
+ *  Convert text-based HOS ocean wave snapshots into the binary format read by
+ *  the `HOSWaves` relaxation zone model. Files are distributed across MPI
+ *  ranks in a round-robin fashion.
+ *
+ *  Inputs (prefix `hos_convert`):
+ *
+ *  - `input_prefix`: prefix of the text files, e.g., `HOSGridData`
+ *  - `output_prefix`: prefix of the binary files (defaults to `input_prefix`)
+ *  - `num_levels`: number of mesh levels with HOS data (default 1)
+ *  - `start`, `end`: range of snapshot indices to convert (inclusive)
+ */
+
+#include "amr-wind/ocean_waves/relaxation_zones/hos_file_io.H"
+#include "amr-wind/utilities/console_io.H"
+
+#include "AMReX.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
+
+int main(int argc, char* argv[])
+{
+#ifdef AMREX_USE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    amr_wind::io::print_banner(MPI_COMM_WORLD, std::cout);
+
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp("amrex");
+        // Set the defaults so that we throw an exception instead of attempting
+        // to generate backtrace files. However, if the user has explicitly set
+        // these options in their input files respect those settings.
+        if (!pp.contains("throw_exception")) pp.add("throw_exception", 1);
+        if (!pp.contains("signal_handling")) pp.add("signal_handling", 0);
+    });
+
+    {
+        BL_PROFILE("hos-convert::main");
+        namespace hos = amr_wind::ocean_waves::hos;
+
+        amrex::ParmParse pp("hos_convert");
+        std::string in_prefix;
+        pp.get("input_prefix", in_prefix);
+        std::string out_prefix = in_prefix;
+        pp.query("output_prefix", out_prefix);
+        int num_levels = 1;
+        pp.query("num_levels", num_levels);
+        int nstart = 0;
+        int nend = 0;
+        pp.get("start", nstart);
+        pp.get("end", nend);
+
+        const int nprocs = amrex::ParallelDescriptor::NProcs();
+        const int myproc = amrex::ParallelDescriptor::MyProc();
+        int ifile = 0;
+        int nconverted = 0;
+        for (int n = nstart; n <= nend; ++n) {
+            for (int lev = 0; lev < num_levels; ++lev, ++ifile) {
+                if (ifile % nprocs != myproc) {
+                    continue;
+                }
+
+                const auto in_file =
+                    hos::file_name(in_prefix, lev, n, hos::FileFormat::Ascii);
+                const auto out_file =
+                    hos::file_name(out_prefix, lev, n, hos::FileFormat::Binary);
+                hos::Snapshot snap;
+                hos::read_ascii(in_file, snap);
+                hos::write_binary(out_file, snap);
+                ++nconverted;
+            }
+        }
+
+        amrex::ParallelDescriptor::ReduceIntSum(nconverted);
+        amrex::Print() << "Converted " << nconverted
+                       << " HOS files to binary format" << std::endl;
+    }
+
+    amrex::Finalize();
+
+#ifdef AMREX_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
@@ -312,6 +312,65 @@ TEST_F(FieldRepoTest, scratch_fields)
     }
 }
 
+TEST_F(FieldRepoTest, scratch_field_pool)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    EXPECT_TRUE(frepo.use_scratch_pool());
+    const auto& stats = frepo.scratch_pool_stats();
+
+    const amrex::Real* data_ptr = nullptr;
+    {
+        auto sfield = frepo.create_scratch_field(3, 1);
+        data_ptr = (*sfield)(0).dataPtr();
+        EXPECT_NE(data_ptr, nullptr);
+        EXPECT_EQ(stats.num_misses, 1);
+        EXPECT_EQ(stats.pooled_bytes, 0);
+    }
+    const auto nbytes = stats.current_bytes;
+    EXPECT_GT(nbytes, 0);
+    EXPECT_EQ(stats.pooled_bytes, nbytes);
+
+    {
+        // Same layout reuses the pooled data
+        auto sfield = frepo.create_scratch_field("reuse", 3, 1);
+        EXPECT_EQ(stats.num_hits, 1);
+        EXPECT_EQ(stats.pooled_bytes, 0);
+        EXPECT_EQ((*sfield)(0).nComp(), 3);
+        EXPECT_EQ((*sfield)(0).nGrowVect(), amrex::IntVect(1));
+        EXPECT_EQ((*sfield)(0).dataPtr(), data_ptr);
+
+        // Different layouts require new allocations
+        auto sfield_nd =
+            frepo.create_scratch_field(3, 1, amr_wind::FieldLoc::NODE);
+        auto sfield_ng = frepo.create_scratch_field(3, 0);
+        EXPECT_EQ(stats.num_misses, 3);
+        EXPECT_EQ(stats.peak_bytes, stats.current_bytes);
+    }
+    EXPECT_EQ(stats.pooled_bytes, stats.current_bytes);
+
+    // Data moved out of a scratch field is not returned to the pool
+    const auto pooled = stats.pooled_bytes;
+    {
+        auto sfield = frepo.create_scratch_field(3, 1);
+        amrex::MultiFab stolen(std::move((*sfield)(0)));
+    }
+    EXPECT_EQ(stats.pooled_bytes, pooled - nbytes);
+
+    frepo.clear_scratch_pool();
+    EXPECT_EQ(stats.pooled_bytes, 0);
+    EXPECT_EQ(stats.current_bytes, 0);
+
+    frepo.set_scratch_pool(false);
+    {
+        auto sfield = frepo.create_scratch_field(3, 1);
+    }
+    EXPECT_EQ(stats.current_bytes, 0);
+    EXPECT_EQ(stats.num_misses, 3);
+    frepo.set_scratch_pool(true);
+}
+
 TEST_F(FieldRepoTest, int_scratch_fields)
 {
 
@@ -0,0 +1,168 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/core/LoadBalancer.H"
+
+#include <chrono>
+#include <thread>
+
+namespace amr_wind_tests {
+
+class LoadBalancerTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{16, 16, 16}};
+            pp.addarr("n_cell", ncell);
+            pp.add("max_grid_size", 8);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> probhi{{16.0, 16.0, 16.0}};
+            pp.addarr("prob_hi", probhi);
+        }
+        {
+            amrex::ParmParse pp("load_balance");
+            pp.add("method", (std::string) "knapsack");
+            pp.add("cost", m_cost_type);
+            pp.add("vof_interface_weight", 3.0);
+        }
+    }
+
+    void init_vof()
+    {
+        auto& vof = sim().repo().get_field("vof");
+        vof.setVal(1.0);
+        // Interface plane at k = 2 in the lower half of the domain
+        for (amrex::MFIter mfi(vof(0)); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            const auto& varr = vof(0).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    if (k == 2) {
+                        varr(i, j, k) = 0.5;
+                    }
+                });
+        }
+    }
+
+    std::string m_cost_type{"cells"};
+};
+
+TEST_F(LoadBalancerTest, cell_costs)
+{
+    initialize_mesh();
+
+    amr_wind::LoadBalancer lb(sim());
+    lb.initialize();
+    EXPECT_TRUE(lb.enabled());
+    EXPECT_TRUE(lb.balance_on_regrid());
+    EXPECT_FALSE(lb.check_imbalance(10));
+
+    const auto costs = lb.box_costs(0);
+    ASSERT_EQ(costs.size(), 8);
+    for (const auto cost : costs) {
+        EXPECT_NEAR(cost, 512.0, 1.0e-12);
+    }
+
+    amrex::DistributionMapping new_dm;
+    const amrex::Real imb = lb.propose(costs, 0, new_dm);
+    EXPECT_EQ(new_dm.size(), 8);
+    EXPECT_GE(imb, 1.0);
+    EXPECT_NEAR(
+        amr_wind::LoadBalancer::imbalance(costs, new_dm), imb, 1.0e-12);
+}
+
+TEST_F(LoadBalancerTest, work_estimate_costs)
+{
+    m_cost_type = "work_estimate";
+    populate_parameters();
+    create_mesh_instance();
+    sim().repo().declare_field("vof", 1, 1);
+    initialize_mesh();
+    init_vof();
+
+    amr_wind::LoadBalancer lb(sim());
+    lb.initialize();
+
+    const auto& ba = mesh().boxArray(0);
+    const auto costs = lb.box_costs(0);
+    ASSERT_EQ(costs.size(), ba.size());
+
+    amrex::Real total = 0.0;
+    for (int i = 0; i < static_cast<int>(costs.size()); ++i) {
+        total += costs[i];
+        // Boxes containing the interface carry an extra 8 x 8 x (3 - 1)
+        const bool has_interface = (ba[i].smallEnd(2) <= 2);
+        const amrex::Real expected = has_interface ? 512.0 + 128.0 : 512.0;
+        EXPECT_NEAR(costs[i], expected, 1.0e-12);
+    }
+    EXPECT_NEAR(total, 8.0 * 512.0 + 4.0 * 128.0, 1.0e-12);
+}
+
+TEST_F(LoadBalancerTest, timer_costs)
+{
+    m_cost_type = "timers";
+    initialize_mesh();
+
+    amr_wind::LoadBalancer lb(sim());
+    lb.initialize();
+    EXPECT_TRUE(lb.measure_box_times());
+
+    // Without any measurements the work estimate is used
+    const auto& ba = mesh().boxArray(0);
+    const auto& dm = mesh().DistributionMap(0);
+    for (const auto cost : lb.box_costs(0)) {
+        EXPECT_NEAR(cost, 512.0, 1.0e-12);
+    }
+
+    // The timer records the time spent within its scope
+    auto* times = lb.box_times(0);
+    {
+        amr_wind::LoadBalancer::BoxTimer timer(times, 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_GE(times[0], 1.0e-3);
+    lb.reset_timers();
+
+    // Mimic a decomposition onto two ranks where the boxes of the first rank
+    // are four times as expensive as those of the second rank
+    ASSERT_EQ(ba.size(), 8);
+    amrex::Vector<int> pmap(ba.size());
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        pmap[i] = (i < 4) ? 0 : 1;
+    }
+    const amrex::DistributionMapping heavy_dm(pmap);
+
+    times = lb.box_times(0);
+    for (amrex::MFIter mfi(ba, dm); mfi.isValid(); ++mfi) {
+        times[mfi.index()] += (heavy_dm[mfi.index()] == 0) ? 4.0 : 1.0;
+    }
+
+    // The costs are the box times and do not depend on the rank times
+    const auto costs = lb.box_costs(0);
+    for (int i = 0; i < static_cast<int>(costs.size()); ++i) {
+        EXPECT_NEAR(costs[i], (i < 4) ? 4.0 : 1.0, 1.0e-12);
+    }
+
+    const amrex::Real old_imb =
+        amr_wind::LoadBalancer::imbalance(costs, heavy_dm, 2);
+    EXPECT_NEAR(old_imb, 1.6, 1.0e-12);
+    EXPECT_GT(old_imb, lb.imbalance_threshold());
+
+    amrex::DistributionMapping new_dm;
+    const amrex::Real new_imb = lb.propose(costs, 0, new_dm, 2);
+    EXPECT_LT(new_imb, lb.imbalance_threshold());
+    EXPECT_FALSE(new_dm == heavy_dm);
+
+    // Measured times are discarded on reset
+    lb.reset_timers();
+    for (const auto cost : lb.box_costs(0)) {
+        EXPECT_NEAR(cost, 512.0, 1.0e-12);
+    }
+}
+
+} // namespace amr_wind_tests
@@ -1,11 +1,69 @@
 #include "gtest/gtest.h"
 #include "aw_test_utils/MeshTest.H"
+#include "amr-wind/equation_systems/PDEBase.H"
 
 namespace amr_wind_tests {
 
 class PDETest : public MeshTest
 {};
 
+namespace {
+
+void init_temperature(amr_wind::Field& temp)
+{
+    for (int lev = 0; lev < temp.repo().num_active_levels(); ++lev) {
+        for (amrex::MFIter mfi(temp(lev)); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.growntilebox();
+            const auto& tarr = temp(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    tarr(i, j, k) = 300.0 + std::sin(0.7 * i) *
+                                                std::cos(0.3 * j) *
+                                                std::sin(0.5 * k);
+                });
+        }
+    }
+}
+
+/** Solve the temperature diffusion equation after changing the viscosity
+ *
+ *  Returns the maximum difference between the solution obtained with an MLMG
+ *  solver that was used for a previous solve and with a new solver.
+ */
+amrex::Real diffusion_reuse_error(
+    amr_wind::CFDSim& sim, amr_wind::pde::PDEBase& teqn)
+{
+    const amrex::Real dt = 0.5;
+    auto& repo = sim.repo();
+    auto& temp = repo.get_field("temperature");
+    auto& mueff = teqn.fields().mueff;
+    repo.get_field("density").setVal(1.0);
+
+    // First solve creates the MLMG solver
+    init_temperature(temp);
+    mueff.setVal(0.1);
+    teqn.solve(dt);
+
+    // Second solve with updated coefficients
+    init_temperature(temp);
+    mueff.setVal(1.0);
+    teqn.solve(dt);
+    amrex::MultiFab reused(
+        temp(0).boxArray(), temp(0).DistributionMap(), 1, 0);
+    amrex::MultiFab::Copy(reused, temp(0), 0, 0, 1, 0);
+
+    // Same solve with a new diffusion operator and MLMG solver
+    teqn.post_regrid_actions();
+    init_temperature(temp);
+    mueff.setVal(1.0);
+    teqn.solve(dt);
+
+    amrex::MultiFab::Subtract(reused, temp(0), 0, 0, 1, 0);
+    return reused.norminf(0, 0);
+}
+
+} // namespace
+
 TEST_F(PDETest, test_pde_create_godunov)
 {
     amrex::ParmParse pp("incflo");
@@ -38,4 +96,51 @@ TEST_F(PDETest, test_pde_create_mol)
     EXPECT_EQ(mesh().field_repo().num_fields(), 25);
 }
 
+TEST_F(PDETest, test_diffusion_solver_reuse)
+{
+    {
+        amrex::ParmParse pp("incflo");
+        pp.add("use_godunov", 1);
+    }
+    {
+        amrex::ParmParse pp("temperature_diffusion");
+        pp.add("reuse_solver", true);
+    }
+
+    initialize_mesh();
+
+    auto& pde_mgr = mesh().sim().pde_manager();
+    pde_mgr.register_icns();
+    auto& teqn = pde_mgr.register_transport_pde("Temperature");
+    sim().create_turbulence_model();
+    teqn.initialize();
+
+    EXPECT_LT(diffusion_reuse_error(sim(), teqn), 1.0e-8);
+}
+
+#ifdef AMREX_USE_HYPRE
+TEST_F(PDETest, test_diffusion_solver_reuse_hypre)
+{
+    {
+        amrex::ParmParse pp("incflo");
+        pp.add("use_godunov", 1);
+    }
+    {
+        amrex::ParmParse pp("temperature_diffusion");
+        pp.add("reuse_solver", true);
+        pp.add("bottom_solver", (std::string) "hypre");
+    }
+
+    initialize_mesh();
+
+    auto& pde_mgr = mesh().sim().pde_manager();
+    pde_mgr.register_icns();
+    auto& teqn = pde_mgr.register_transport_pde("Temperature");
+    sim().create_turbulence_model();
+    teqn.initialize();
+
+    EXPECT_LT(diffusion_reuse_error(sim(), teqn), 1.0e-8);
+}
+#endif
+
 } // namespace amr_wind_tests
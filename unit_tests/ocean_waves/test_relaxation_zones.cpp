@@ -3,6 +3,7 @@
 #include "aw_test_utils/test_utils.H"
 #include "amr-wind/ocean_waves/utils/wave_utils_K.H"
 #include "amr-wind/ocean_waves/OceanWaves.H"
+#include "amr-wind/ocean_waves/relaxation_zones/hos_file_io.H"
 #include "amr-wind/physics/multiphase/MultiPhase.H"
 
 namespace amr_wind_tests {
@@ -623,4 +624,66 @@ TEST_F(OceanWavesOpTest, HOS_restart)
     }
 }
 
+TEST_F(OceanWavesOpTest, HOS_binary_io)
+{
+    namespace hos = amr_wind::ocean_waves::hos;
+    constexpr double tol = 1.0e-12;
+
+    // Write text files and convert them to binary
+    amrex::Vector<hos::Snapshot> ref(2);
+    for (int n = 0; n < 2; ++n) {
+        const auto txt_file =
+            hos::file_name("HOSGridData", 0, n, hos::FileFormat::Ascii);
+        const auto bin_file =
+            hos::file_name("HOSGridData", 0, n, hos::FileFormat::Binary);
+        write_HOS_txt(txt_file, 1.0 - 0.1 * n);
+        hos::read_ascii(txt_file, ref[n]);
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            hos::write_binary(bin_file, ref[n]);
+        }
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    // Read the binary files, with the second file prefetched
+    hos::HOSReader reader("HOSGridData", hos::FileFormat::Binary, true);
+    for (int n = 0; n < 2; ++n) {
+        hos::Snapshot snap;
+        reader.read(0, n, snap);
+        reader.prefetch(1, n + 1);
+
+        EXPECT_NEAR(snap.t, ref[n].t, tol);
+        EXPECT_NEAR(snap.dt, ref[n].dt, tol);
+        EXPECT_EQ(snap.nx, 32);
+        EXPECT_EQ(snap.ny, 4);
+        EXPECT_EQ(snap.nz, 4);
+        EXPECT_NEAR(snap.Lx, ref[n].Lx, tol);
+        EXPECT_NEAR(snap.Ly, ref[n].Ly, tol);
+        EXPECT_NEAR(snap.zmin, ref[n].zmin, tol);
+        EXPECT_NEAR(snap.zmax, ref[n].zmax, tol);
+        ASSERT_EQ(snap.eta.size(), ref[n].eta.size());
+        ASSERT_EQ(snap.u.size(), ref[n].u.size());
+        for (int i = 0; i < static_cast<int>(snap.eta.size()); ++i) {
+            EXPECT_NEAR(snap.eta[i], ref[n].eta[i], tol);
+        }
+        for (int i = 0; i < static_cast<int>(snap.u.size()); ++i) {
+            EXPECT_NEAR(snap.u[i], ref[n].u[i], tol);
+            EXPECT_NEAR(snap.v[i], ref[n].v[i], tol);
+            EXPECT_NEAR(snap.w[i], ref[n].w[i], tol);
+        }
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    // Clean up files
+    for (int n = 0; n < 2; ++n) {
+        for (const auto fmt :
+             {hos::FileFormat::Ascii, hos::FileFormat::Binary}) {
+            const auto fname = hos::file_name("HOSGridData", 0, n, fmt);
+            std::ifstream f(fname);
+            if (f.good()) {
+                remove(fname.c_str());
+            }
+        }
+    }
+}
+
 } // namespace amr_wind_tests
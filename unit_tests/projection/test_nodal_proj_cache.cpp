@@ -0,0 +1,174 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/incflo.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Set a velocity field that is not divergence free
+void init_velocity(amr_wind::Field& vel)
+{
+    const int nlevels = vel.repo().num_active_levels();
+    const auto& geom = vel.repo().mesh().Geom();
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& problo = geom[lev].ProbLoArray();
+
+        for (amrex::MFIter mfi(vel(lev)); mfi.isValid(); ++mfi) {
+            auto gbx = mfi.growntilebox();
+            const auto& varr = vel(lev).array(mfi);
+
+            amrex::ParallelFor(gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                varr(i, j, k, 0) = std::sin(2.0 * M_PI * x) * z;
+                varr(i, j, k, 1) = std::cos(2.0 * M_PI * y) * z * z;
+                varr(i, j, k, 2) =
+                    std::sin(M_PI * z) * std::cos(2.0 * M_PI * (x + y));
+            });
+        }
+    }
+}
+
+//! Maximum difference over all components and levels of two fields
+amrex::Real max_diff(
+    const amrex::Vector<amrex::MultiFab>& ref, const amr_wind::Field& fld)
+{
+    amrex::Real err = 0.0;
+    for (int lev = 0; lev < static_cast<int>(ref.size()); ++lev) {
+        const int ncomp = ref[lev].nComp();
+        amrex::MultiFab diff(
+            ref[lev].boxArray(), ref[lev].DistributionMap(), ncomp, 0);
+        amrex::MultiFab::Copy(diff, fld(lev), 0, 0, ncomp, 0);
+        amrex::MultiFab::Subtract(diff, ref[lev], 0, 0, ncomp, 0);
+        for (int n = 0; n < ncomp; ++n) {
+            err = amrex::max(err, diff.norm0(n));
+        }
+    }
+    return err;
+}
+
+//! Copy a field (including ghost cells) into a vector of MultiFabs
+void save_field(
+    const amr_wind::Field& fld, amrex::Vector<amrex::MultiFab>& saved)
+{
+    const int nlevels = fld.repo().num_active_levels();
+    saved.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& mf = fld(lev);
+        saved[lev].define(
+            mf.boxArray(), mf.DistributionMap(), mf.nComp(), mf.nGrowVect());
+        amrex::MultiFab::Copy(saved[lev], mf, 0, 0, mf.nComp(), mf.nGrowVect());
+    }
+}
+
+//! Restore a field (including ghost cells) from a vector of MultiFabs
+void restore_field(
+    amr_wind::Field& fld, const amrex::Vector<amrex::MultiFab>& saved)
+{
+    for (int lev = 0; lev < static_cast<int>(saved.size()); ++lev) {
+        amrex::MultiFab::Copy(
+            fld(lev), saved[lev], 0, 0, saved[lev].nComp(),
+            saved[lev].nGrowVect());
+    }
+}
+
+} // namespace
+
+class NodalProjCache : public AmrexTest
+{
+protected:
+    void populate_parameters()
+    {
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{m_nx, m_nx, m_nx}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", m_nx / 2);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{1.0, 1.0, 1.0}};
+            amrex::Vector<int> periodic{{1, 1, 0}};
+
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+            pp.addarr("is_periodic", periodic);
+        }
+        {
+            amrex::ParmParse pp("incflo");
+            pp.add("use_godunov", (int)1);
+        }
+        {
+            amrex::ParmParse pp("nodal_proj");
+            pp.add("reuse_solver", (int)1);
+            pp.add("mg_rtol", 1.0e-12);
+            pp.add("mg_atol", 1.0e-14);
+        }
+
+        // Boundary conditions
+        amrex::ParmParse ppzlo("zlo");
+        ppzlo.add("type", (std::string) "slip_wall");
+        amrex::ParmParse ppzhi("zhi");
+        ppzhi.add("type", (std::string) "pressure_outflow");
+    }
+
+    const int m_nx = 16;
+};
+
+TEST_F(NodalProjCache, sigma_rescaling)
+{
+    populate_parameters();
+
+    incflo my_incflo;
+    my_incflo.init_mesh();
+    auto& repo = my_incflo.sim().repo();
+    auto& density = repo.get_field("density");
+    auto& velocity = repo.get_field("velocity");
+    auto& pressure = repo.get_field("p");
+    auto& grad_p = repo.get_field("gp");
+    density.setVal(1.0);
+
+    // Build and cache the projector with the first dt
+    const amrex::Real dt0 = 0.5;
+    init_velocity(velocity);
+    my_incflo.ApplyProjection(density.vec_const_ptrs(), 1.0, dt0, false);
+
+    amrex::Vector<amrex::MultiFab> p_n, gp_n;
+    save_field(pressure, p_n);
+    save_field(grad_p, gp_n);
+
+    // Project with the cached projector at a different dt
+    const amrex::Real dt1 = 0.2;
+    init_velocity(velocity);
+    my_incflo.ApplyProjection(density.vec_const_ptrs(), 2.0, dt1, false);
+
+    amrex::Vector<amrex::MultiFab> p_cached, gp_cached, vel_cached;
+    save_field(pressure, p_cached);
+    save_field(grad_p, gp_cached);
+    save_field(velocity, vel_cached);
+
+    // Repeat the second projection with a freshly built projector
+    {
+        amrex::ParmParse pp("nodal_proj");
+        pp.add("reuse_solver", (int)0);
+    }
+    restore_field(pressure, p_n);
+    restore_field(grad_p, gp_n);
+    init_velocity(velocity);
+    my_incflo.ApplyProjection(density.vec_const_ptrs(), 2.0, dt1, false);
+
+    // The pressure must be non-trivial for the comparison to be meaningful
+    EXPECT_GT(pressure(0).norm0(), 1.0e-2);
+
+    const amrex::Real tol = 1.0e-8;
+    EXPECT_NEAR(max_diff(p_cached, pressure), 0.0, tol);
+    EXPECT_NEAR(max_diff(gp_cached, grad_p), 0.0, tol);
+    EXPECT_NEAR(max_diff(vel_cached, velocity), 0.0, tol);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,138 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+
+#include "amr-wind/utilities/FieldPlaneAveraging.H"
+#include "amr-wind/utilities/SecondMomentAveraging.H"
+#include "amr-wind/utilities/ThirdMomentAveraging.H"
+#include "amr-wind/utilities/FusedPlaneAveraging.H"
+#include "amr-wind/utilities/trig_ops.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_fields(
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& a,
+    const amrex::Geometry& geom,
+    const amrex::Box& bx,
+    const amrex::Array4<amrex::Real>& vel,
+    const amrex::Array4<amrex::Real>& temp)
+{
+    auto xlo = geom.ProbLoArray();
+    auto dx = geom.CellSizeArray();
+
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        const amrex::Real x = xlo[0] + (i + 0.5) * dx[0];
+        const amrex::Real y = xlo[1] + (j + 0.5) * dx[1];
+        const amrex::Real z = xlo[2] + (k + 0.5) * dx[2];
+
+        vel(i, j, k, 0) = 8.0 + std::cos(a[0] * x) * std::sin(a[2] * z);
+        vel(i, j, k, 1) = 2.0 + std::sin(a[1] * y) + 0.1 * z;
+        vel(i, j, k, 2) =
+            std::sin(a[0] * x) * std::cos(a[1] * y) * std::cos(a[2] * z);
+        temp(i, j, k, 0) = 300.0 + 0.5 * std::cos(a[0] * x + a[1] * y) + z;
+    });
+}
+
+} // namespace
+
+class FusedPlaneAveragingTest : public MeshTest
+{
+public:
+    void test_dir(int /*dir*/);
+};
+
+void FusedPlaneAveragingTest::test_dir(int dir)
+{
+    constexpr double tol = 1.0e-11;
+    constexpr int periods = 2;
+
+    populate_parameters();
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    auto& velocityf = frepo.declare_field("velocity", 3);
+    auto& temperaturef = frepo.declare_field("temperature", 1);
+
+    const auto& problo = mesh().Geom(0).ProbLoArray();
+    const auto& probhi = mesh().Geom(0).ProbHiArray();
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> a;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        a[i] = periods * amr_wind::utils::two_pi() / (probhi[i] - problo[i]);
+    }
+
+    run_algorithm(
+        mesh().num_levels(), velocityf.vec_ptrs(),
+        [&](const int lev, const amrex::MFIter& mfi) {
+            init_fields(
+                a, mesh().Geom(lev), mfi.validbox(), velocityf(lev).array(mfi),
+                temperaturef(lev).array(mfi));
+        });
+
+    // Reference results using the individual objects
+    amr_wind::VelPlaneAveraging pa_vel(sim(), dir);
+    amr_wind::FieldPlaneAveraging pa_temp(temperaturef, sim().time(), dir);
+    amr_wind::SecondMomentAveraging pa_tu(pa_vel, pa_temp);
+    amr_wind::SecondMomentAveraging pa_uu(pa_vel, pa_vel);
+    amr_wind::ThirdMomentAveraging pa_uuu(pa_vel, pa_vel, pa_vel);
+    pa_vel();
+    pa_temp();
+    pa_tu();
+    pa_uu();
+    pa_uuu();
+
+    amr_wind::VelPlaneAveraging fa_vel(sim(), dir);
+    amr_wind::FieldPlaneAveraging fa_temp(temperaturef, sim().time(), dir);
+    amr_wind::SecondMomentAveraging fa_tu(fa_vel, fa_temp);
+    amr_wind::SecondMomentAveraging fa_uu(fa_vel, fa_vel);
+    amr_wind::ThirdMomentAveraging fa_uuu(fa_vel, fa_vel, fa_vel);
+    amr_wind::FusedPlaneAveraging fused;
+    fused.add(fa_vel);
+    fused.add(fa_temp);
+    fused.add(fa_tu);
+    fused.add(fa_uu);
+    fused.add(fa_uuu);
+
+    // 3 + 1 means, hvelmag, 3 + 6 pairs (shared), 10 unique triples
+    EXPECT_EQ(fused.num_terms(false), 5);
+    EXPECT_EQ(fused.num_terms(), 24);
+
+    // First call shifts by zero, second by the averages from the first call
+    for (int iter = 0; iter < 2; ++iter) {
+        fused();
+
+        const int ncell = pa_vel.ncell_line();
+        for (int i = 0; i < ncell; ++i) {
+            for (int n = 0; n < 3; ++n) {
+                EXPECT_NEAR(
+                    fa_vel.line_average_cell(i, n),
+                    pa_vel.line_average_cell(i, n), tol);
+                EXPECT_NEAR(
+                    fa_tu.line_moment()[3 * i + n],
+                    pa_tu.line_moment()[3 * i + n], tol);
+            }
+            EXPECT_NEAR(
+                fa_vel.line_hvelmag_average()[i],
+                pa_vel.line_hvelmag_average()[i], tol);
+            EXPECT_NEAR(
+                fa_temp.line_average_cell(i, 0),
+                pa_temp.line_average_cell(i, 0), tol);
+            for (int n = 0; n < 9; ++n) {
+                EXPECT_NEAR(
+                    fa_uu.line_moment()[9 * i + n],
+                    pa_uu.line_moment()[9 * i + n], tol);
+            }
+            for (int n = 0; n < 27; ++n) {
+                EXPECT_NEAR(
+                    fa_uuu.line_moment()[27 * i + n],
+                    pa_uuu.line_moment()[27 * i + n], tol);
+            }
+        }
+    }
+}
+
+TEST_F(FusedPlaneAveragingTest, test_xdir) { test_dir(0); }
+TEST_F(FusedPlaneAveragingTest, test_ydir) { test_dir(1); }
+TEST_F(FusedPlaneAveragingTest, test_zdir) { test_dir(2); }
+
+} // namespace amr_wind_tests
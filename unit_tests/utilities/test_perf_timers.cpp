@@ -0,0 +1,217 @@
+#include "aw_test_utils/AmrexTest.H"
+
+#include "amr-wind/utilities/PerfTimers.H"
+
+#include "AMReX_ParallelDescriptor.H"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+namespace amr_wind_tests {
+
+class PerfTimersTest : public AmrexTest
+{};
+
+TEST_F(PerfTimersTest, disabled_by_default)
+{
+    amr_wind::PerfTimers timers;
+    EXPECT_FALSE(timers.enabled());
+
+    timers.begin_step();
+    {
+        auto scope = timers.scope("advection");
+    }
+    timers.end_step(1, 0.1, 0.1, 1.0, 8);
+
+    EXPECT_TRUE(timers.phase_names().empty());
+    EXPECT_TRUE(timers.history().empty());
+}
+
+TEST_F(PerfTimersTest, phase_times)
+{
+    {
+        amrex::ParmParse pp("perf");
+        pp.add("timers", true);
+    }
+    amr_wind::PerfTimers timers;
+    ASSERT_TRUE(timers.enabled());
+
+    const int nsteps = 3;
+    for (int n = 0; n < nsteps; ++n) {
+        timers.begin_step();
+        {
+            auto outer = timers.scope("predictor");
+            for (int i = 0; i < 2; ++i) {
+                auto inner = timers.scope("advection");
+            }
+        }
+        timers.add_time(timers.phase_id("io"), 0.5);
+        timers.end_step(n + 1, 0.1 * (n + 1), 0.1, 1.0, 64);
+    }
+
+    const auto& names = timers.phase_names();
+    ASSERT_EQ(static_cast<int>(names.size()), 3);
+    EXPECT_EQ(names[0], "predictor");
+    EXPECT_EQ(names[1], "advection");
+    EXPECT_EQ(names[2], "io");
+    EXPECT_EQ(timers.phase_id("advection"), 1);
+
+    const auto& history = timers.history();
+    ASSERT_EQ(static_cast<int>(history.size()), nsteps);
+    for (int n = 0; n < nsteps; ++n) {
+        const auto& rec = history[n];
+        EXPECT_EQ(rec.step, n + 1);
+        EXPECT_EQ(rec.num_cells, 64);
+        ASSERT_EQ(static_cast<int>(rec.phase_times.size()), 3);
+        EXPECT_GE(rec.phase_times[0], rec.phase_times[1]);
+        EXPECT_GE(rec.phase_times[1], 0.0);
+        // Times are reset at the start of every step
+        EXPECT_DOUBLE_EQ(rec.phase_times[2], 0.5);
+    }
+
+    EXPECT_GE(amr_wind::perf::resident_memory_hwm(), 0);
+}
+
+TEST_F(PerfTimersTest, solver_iterations_and_events)
+{
+    {
+        amrex::ParmParse pp("perf");
+        pp.add("timers", true);
+    }
+    amr_wind::PerfTimers timers;
+
+    // Solves before the first step are discarded
+    amr_wind::perf::record_solver_iterations("Nodal_projection", 20);
+
+    timers.begin_step();
+    amr_wind::perf::record_solver_iterations("MAC_projection", 5);
+    amr_wind::perf::record_solver_iterations("velocity_solve", 3);
+    amr_wind::perf::record_solver_iterations("MAC_projection", 4);
+    timers.add_event("regrid");
+    timers.end_step(1, 0.1, 0.1, 1.0, 64);
+
+    timers.begin_step();
+    amr_wind::perf::record_solver_iterations("velocity_solve", 2);
+    timers.add_event("plot_file");
+    timers.add_event("plot_file");
+    timers.end_step(2, 0.2, 0.1, 1.0, 64);
+
+    const auto& solvers = timers.solver_names();
+    ASSERT_EQ(static_cast<int>(solvers.size()), 2);
+    EXPECT_EQ(solvers[0], "MAC_projection");
+    EXPECT_EQ(solvers[1], "velocity_solve");
+
+    const auto& events = timers.event_names();
+    ASSERT_EQ(static_cast<int>(events.size()), 2);
+    EXPECT_EQ(events[0], "regrid");
+    EXPECT_EQ(events[1], "plot_file");
+
+    const auto& history = timers.history();
+    ASSERT_EQ(static_cast<int>(history.size()), 2);
+    ASSERT_EQ(static_cast<int>(history[0].solver_iters.size()), 2);
+    EXPECT_EQ(history[0].solver_iters[0], 9);
+    EXPECT_EQ(history[0].solver_iters[1], 3);
+    ASSERT_EQ(static_cast<int>(history[1].solver_iters.size()), 2);
+    EXPECT_EQ(history[1].solver_iters[0], 0);
+    EXPECT_EQ(history[1].solver_iters[1], 2);
+
+    ASSERT_EQ(static_cast<int>(history[0].event_counts.size()), 1);
+    EXPECT_EQ(history[0].event_counts[0], 1);
+    ASSERT_EQ(static_cast<int>(history[1].event_counts.size()), 2);
+    EXPECT_EQ(history[1].event_counts[0], 0);
+    EXPECT_EQ(history[1].event_counts[1], 2);
+}
+
+TEST_F(PerfTimersTest, csv_telemetry)
+{
+    {
+        amrex::ParmParse pp("perf");
+        pp.add("telemetry_format", std::string("csv"));
+        pp.add("telemetry_interval", 2);
+        pp.add("keep_history", false);
+    }
+    amr_wind::PerfTimers timers;
+    ASSERT_TRUE(timers.enabled());
+
+    const int nsteps = 3;
+    for (int n = 0; n < nsteps; ++n) {
+        timers.begin_step();
+        {
+            auto scope = timers.scope("advection");
+        }
+        amr_wind::perf::record_solver_iterations("MAC_projection", 4);
+        timers.end_step(n + 1, 0.1 * (n + 1), 0.1, 1.0, 64);
+    }
+    EXPECT_TRUE(timers.history().empty());
+    timers.flush_telemetry();
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ifstream infile("post_processing/perf_telemetry00000.csv");
+        ASSERT_TRUE(infile.good());
+        std::string line;
+        std::getline(infile, line);
+        EXPECT_EQ(
+            line,
+            "step,time,dt,wall_time,num_cells,resident_hwm,fab_memory,"
+            "advection_max,advection_avg,MAC_projection_iters");
+        int nrows = 0;
+        while (std::getline(infile, line)) {
+            ++nrows;
+            EXPECT_EQ(line.substr(0, line.find(',')), std::to_string(nrows));
+            EXPECT_EQ(line.substr(line.rfind(',') + 1), "4");
+        }
+        EXPECT_EQ(nrows, nsteps);
+    }
+}
+
+TEST_F(PerfTimersTest, csv_telemetry_late_columns)
+{
+    {
+        amrex::ParmParse pp("perf");
+        pp.add("telemetry_format", std::string("csv"));
+        pp.add("telemetry_interval", 2);
+        pp.add("keep_history", false);
+    }
+    amr_wind::PerfTimers timers;
+
+    // The phase and the event first appear after the first write
+    const int step0 = 10;
+    const int nsteps = 4;
+    for (int n = 0; n < nsteps; ++n) {
+        timers.begin_step();
+        {
+            auto scope = timers.scope("advection");
+        }
+        if (n == 2) {
+            auto scope = timers.scope("io");
+            timers.add_event("plot_file");
+        }
+        timers.end_step(step0 + n + 1, 0.1 * (n + 1), 0.1, 1.0, 64);
+    }
+    timers.flush_telemetry();
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ifstream infile("post_processing/perf_telemetry00010.csv");
+        ASSERT_TRUE(infile.good());
+        std::string line;
+        std::getline(infile, line);
+        EXPECT_EQ(
+            line,
+            "step,time,dt,wall_time,num_cells,resident_hwm,fab_memory,"
+            "advection_max,io_max,advection_avg,io_avg,plot_file");
+        int nrows = 0;
+        while (std::getline(infile, line)) {
+            EXPECT_EQ(
+                line.substr(0, line.find(',')),
+                std::to_string(step0 + nrows + 1));
+            EXPECT_EQ(std::count(line.begin(), line.end(), ','), 11);
+            EXPECT_EQ(
+                line.substr(line.rfind(',') + 1), (nrows == 2) ? "1" : "0");
+            ++nrows;
+        }
+        EXPECT_EQ(nrows, nsteps);
+    }
+}
+
+} // namespace amr_wind_tests
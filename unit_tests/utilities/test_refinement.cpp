@@ -12,6 +12,8 @@
 #include "AMReX_Vector.H"
 
 #include "amr-wind/utilities/tagging/CartBoxRefinement.H"
+#include "amr-wind/utilities/tagging/RefinementCriteria.H"
+#include "amr-wind/utilities/trig_ops.H"
 
 namespace amr_wind_tests {
 
@@ -138,4 +140,233 @@ TEST_F(NestRefineTest, bbox_limits)
     EXPECT_EQ(bx.bigEnd(), big_end.diagShift(1));
 }
 
+//! Test fixture for solution-based refinement criteria
+class FusedRefineTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{16, 16, 16}};
+            pp.addarr("n_cell", ncell);
+            pp.add("max_grid_size", 8);
+        }
+        {
+            amrex::ParmParse pp("tagging");
+            amrex::Vector<std::string> labels{"v1", "q1", "q2", "f1", "g1"};
+            pp.addarr("labels", labels);
+        }
+        {
+            amrex::ParmParse pp("tagging.v1");
+            pp.add("type", std::string("VorticityMagRefinement"));
+            pp.addarr("values", amrex::Vector<amrex::Real>{1.2});
+        }
+        {
+            amrex::ParmParse pp("tagging.q1");
+            pp.add("type", std::string("QCriterionRefinement"));
+            pp.addarr("values", amrex::Vector<amrex::Real>{0.5});
+        }
+        {
+            amrex::ParmParse pp("tagging.q2");
+            pp.add("type", std::string("QCriterionRefinement"));
+            pp.addarr("values", amrex::Vector<amrex::Real>{0.3});
+            pp.add("nondim", false);
+        }
+        {
+            amrex::ParmParse pp("tagging.f1");
+            pp.add("type", std::string("FieldRefinement"));
+            pp.add("field_name", std::string("velocity"));
+            pp.addarr("field_error", amrex::Vector<amrex::Real>{1.4});
+            pp.addarr("grad_error", amrex::Vector<amrex::Real>{0.7});
+        }
+        {
+            amrex::ParmParse pp("tagging.g1");
+            pp.add("type", std::string("GradientMagRefinement"));
+            pp.add("field_name", std::string("velocity"));
+            pp.addarr("values", amrex::Vector<amrex::Real>{0.75});
+        }
+    }
+
+    void init_velocity()
+    {
+        auto& vel = mesh().field_repo().declare_field("velocity", 3, 1);
+        vel.set_default_fillpatch_bc(sim().time());
+
+        const auto& geom = mesh().Geom(0);
+        const auto& dx = geom.CellSizeArray();
+        const auto& problo = geom.ProbLoArray();
+        const amrex::Real kk =
+            amr_wind::utils::two_pi() / (geom.ProbHi(0) - geom.ProbLo(0));
+        for (amrex::MFIter mfi(vel(0)); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& varr = vel(0).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                    const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                    const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                    varr(i, j, k, 0) =
+                        std::sin(kk * y) + 0.5 * std::sin(kk * z);
+                    varr(i, j, k, 1) = std::cos(kk * x);
+                    varr(i, j, k, 2) = std::sin(kk * (x + y));
+                });
+        }
+    }
+
+    //! Signed distance from a sphere centered on a node in the middle of the
+    //! domain, set on all levels including ghost cells
+    void init_distance()
+    {
+        auto& phi = mesh().field_repo().declare_field("phi", 1, 1);
+        phi.set_default_fillpatch_bc(sim().time());
+
+        const amrex::Real radius = 1.0;
+        for (int lev = 0; lev <= mesh().finestLevel(); ++lev) {
+            const auto& geom = mesh().Geom(lev);
+            const auto& dx = geom.CellSizeArray();
+            const auto& problo = geom.ProbLoArray();
+            const amrex::Real xc = 0.5 * (geom.ProbLo(0) + geom.ProbHi(0));
+            const amrex::Real yc = 0.5 * (geom.ProbLo(1) + geom.ProbHi(1));
+            const amrex::Real zc = 0.5 * (geom.ProbLo(2) + geom.ProbHi(2));
+            for (amrex::MFIter mfi(phi(lev)); mfi.isValid(); ++mfi) {
+                const auto& bx = mfi.growntilebox();
+                const auto& parr = phi(lev).array(mfi);
+                amrex::ParallelFor(
+                    bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                        const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                        const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                        const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                        parr(i, j, k) =
+                            std::sqrt(
+                                (x - xc) * (x - xc) + (y - yc) * (y - yc) +
+                                (z - zc) * (z - zc)) -
+                            radius;
+                    });
+            }
+        }
+
+        // Criteria without a value on a level do not fillpatch the field
+        // there, so start both code paths from the same ghost cells
+        phi.fillpatch(0.0);
+    }
+
+    amrex::Long
+    tag_cells(amrex::TagBoxArray& tags, const bool fused, const int lev = 0)
+    {
+        {
+            amrex::ParmParse pp("tagging");
+            pp.add("fused", fused);
+        }
+        amr_wind::RefineCriteriaManager refiner(sim());
+        refiner.initialize();
+        tags.setVal(amrex::TagBox::CLEAR);
+        refiner.tag_cells(lev, tags, 0.0, 0);
+
+        auto ntags = amrex::ReduceSum(
+            tags, 0,
+            [=] AMREX_GPU_HOST_DEVICE(
+                amrex::Box const& bx,
+                amrex::Array4<char const> const& tarr) -> amrex::Long {
+                amrex::Long ncount = 0;
+                amrex::Loop(bx, [=, &ncount](int i, int j, int k) noexcept {
+                    if (tarr(i, j, k) == amrex::TagBox::SET) {
+                        ++ncount;
+                    }
+                });
+                return ncount;
+            });
+        amrex::ParallelDescriptor::ReduceLongSum(ntags);
+        return ntags;
+    }
+
+    //! Number of cells tagged differently in the two tag arrays
+    static amrex::Long
+    count_diff(const amrex::TagBoxArray& tags1, const amrex::TagBoxArray& tags2)
+    {
+        auto ndiff = amrex::ReduceSum(
+            tags1, tags2, 0,
+            [=] AMREX_GPU_HOST_DEVICE(
+                amrex::Box const& bx, amrex::Array4<char const> const& t1,
+                amrex::Array4<char const> const& t2) -> amrex::Long {
+                amrex::Long ncount = 0;
+                amrex::Loop(bx, [=, &ncount](int i, int j, int k) noexcept {
+                    if (t1(i, j, k) != t2(i, j, k)) {
+                        ++ncount;
+                    }
+                });
+                return ncount;
+            });
+        amrex::ParallelDescriptor::ReduceLongSum(ndiff);
+        return ndiff;
+    }
+};
+
+TEST_F(FusedRefineTest, fused_matches_separate)
+{
+    initialize_mesh();
+    init_velocity();
+
+    const auto& ba = mesh().boxArray(0);
+    const auto& dm = mesh().DistributionMap(0);
+    amrex::TagBoxArray tags_sep(ba, dm);
+    amrex::TagBoxArray tags_fused(ba, dm);
+
+    const auto nsep = tag_cells(tags_sep, false);
+    const auto nfused = tag_cells(tags_fused, true);
+    EXPECT_GT(nsep, 0);
+    EXPECT_LT(nsep, ba.numPts());
+    EXPECT_EQ(nsep, nfused);
+    EXPECT_EQ(count_diff(tags_sep, tags_fused), 0);
+}
+
+TEST_F(FusedRefineTest, curvature_multilevel)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_level", 1);
+    }
+    {
+        // Only level 0 has a threshold, finer levels tag above 1/dx
+        amrex::ParmParse pp("tagging");
+        pp.addarr("labels", amrex::Vector<std::string>{"c1"});
+        amrex::ParmParse ppc("tagging.c1");
+        ppc.add("type", std::string("CurvatureRefinement"));
+        ppc.add("field_name", std::string("phi"));
+        ppc.addarr("values", amrex::Vector<amrex::Real>{1.0});
+    }
+
+    // Refine the middle of the domain around the sphere
+    std::stringstream ss;
+    ss << "1 // Number of levels" << std::endl;
+    ss << "1 // Number of boxes at this level" << std::endl;
+    ss << "2.0 2.0 2.0 6.0 6.0 6.0" << std::endl;
+
+    create_mesh_instance<RefineMesh>();
+    std::unique_ptr<amr_wind::CartBoxRefinement> box_refine(
+        new amr_wind::CartBoxRefinement(sim()));
+    box_refine->read_inputs(mesh(), ss);
+    mesh<RefineMesh>()->refine_criteria_vec().push_back(std::move(box_refine));
+    initialize_mesh();
+    ASSERT_EQ(mesh().finestLevel(), 1);
+
+    init_distance();
+
+    for (int lev = 0; lev <= mesh().finestLevel(); ++lev) {
+        const auto& ba = mesh().boxArray(lev);
+        const auto& dm = mesh().DistributionMap(lev);
+        amrex::TagBoxArray tags_sep(ba, dm);
+        amrex::TagBoxArray tags_fused(ba, dm);
+
+        const auto nsep = tag_cells(tags_sep, false, lev);
+        const auto nfused = tag_cells(tags_fused, true, lev);
+        EXPECT_GT(nsep, 0);
+        EXPECT_LT(nsep, ba.numPts());
+        EXPECT_EQ(nsep, nfused);
+        EXPECT_EQ(count_diff(tags_sep, tags_fused), 0);
+    }
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,124 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+
+#include "amr-wind/utilities/sampling/Sampling.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Linear field so that the interpolation to the probes is exact
+void init_field(amr_wind::Field& fld)
+{
+    const auto& mesh = fld.repo().mesh();
+    const int ncomp = fld.num_comp();
+    run_algorithm(fld, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& dx = mesh.Geom(lev).CellSizeArray();
+        const auto& problo = mesh.Geom(lev).ProbLoArray();
+        const auto& farr = fld(lev).array(mfi);
+        const auto& bx = mfi.growntilebox();
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+            const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+            const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+            for (int d = 0; d < ncomp; d++) {
+                farr(i, j, k, d) = (d + 1) * (x + y + z);
+            }
+        });
+    });
+}
+
+} // namespace
+
+class SamplingNcfTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{32, 32, 64}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", 16);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{128.0, 128.0, 128.0}};
+
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+};
+
+TEST_F(SamplingNcfTest, collective_output)
+{
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 2);
+    init_field(vel);
+
+    const int npts = 16;
+    {
+        amrex::ParmParse pp("sampling");
+        pp.add("output_frequency", 1);
+        pp.add("output_format", std::string("netcdf"));
+        pp.add("parallel_netcdf", true);
+        pp.addarr("labels", amrex::Vector<std::string>{"line1"});
+        pp.addarr("fields", amrex::Vector<std::string>{"velocity"});
+    }
+    {
+        amrex::ParmParse pp("sampling.line1");
+        pp.add("type", std::string("LineSampler"));
+        pp.add("num_points", npts);
+        pp.addarr("start", amrex::Vector<amrex::Real>{66.0, 66.0, 1.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{66.0, 66.0, 127.0});
+    }
+
+    // The file is closed when the sampling object goes out of scope
+    {
+        amr_wind::sampling::Sampling probes(sim(), "sampling");
+        probes.initialize();
+        probes.post_advance_work();
+    }
+
+    const std::string fname =
+        "post_processing/" +
+        amrex::Concatenate("sampling", time().time_index()) + ".nc";
+    auto ncf = ncutils::NCFile::open_par(
+        fname, NC_NOWRITE | NC_MPIIO,
+        amrex::ParallelDescriptor::Communicator(), MPI_INFO_NULL);
+    ncf.par_access(NC_COLLECTIVE);
+    ASSERT_EQ(ncf.dim("num_time_steps").len(), 1u);
+
+    amrex::Real time_out = -1.0;
+    ncf.var("time").get(&time_out, {0}, {1});
+    EXPECT_NEAR(time_out, time().new_time(), 1.0e-12);
+
+    ASSERT_TRUE(ncf.has_group("line1"));
+    auto grp = ncf.group("line1");
+    ASSERT_EQ(grp.dim("num_points").len(), static_cast<size_t>(npts));
+
+    std::vector<double> xyz(npts * AMREX_SPACEDIM);
+    grp.var("coordinates")
+        .get(xyz.data(), {0, 0}, {static_cast<size_t>(npts), AMREX_SPACEDIM});
+
+    const amrex::Vector<std::string> vnames{
+        "velocityx", "velocityy", "velocityz"};
+    std::vector<double> vals(npts);
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        grp.var(vnames[d]).get(
+            vals.data(), {0, 0}, {1, static_cast<size_t>(npts)});
+        for (int ip = 0; ip < npts; ++ip) {
+            const double* pt = &xyz[ip * AMREX_SPACEDIM];
+            const amrex::Real gold = (d + 1) * (pt[0] + pt[1] + pt[2]);
+            EXPECT_NEAR(vals[ip], gold, 1.0e-10) << vnames[d] << " " << ip;
+        }
+    }
+}
+
+} // namespace amr_wind_tests
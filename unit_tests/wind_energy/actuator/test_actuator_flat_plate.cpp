@@ -283,4 +283,89 @@ TEST_F(ActFlatPlateTest, flat_plate_init)
     act.pre_init_actions();
     act.post_init_actions();
 }
+
+TEST_F(ActFlatPlateTest, line_spreading_cutoff)
+{
+    initialize_mesh();
+    auto& src = sim().repo().declare_field("actuator_src_term", 3, 0);
+    auto& src_gold = sim().repo().declare_field("actuator_src_gold", 3, 0);
+
+    FlatPlate::DataType data(sim(), "F1", 0);
+    {
+        const int npts = 11;
+        auto& grid = data.grid();
+        grid.resize(npts);
+        const auto tmat = vs::quaternion(vs::Vector::khat(), 30.0);
+        for (int ip = 0; ip < npts; ++ip) {
+            grid.pos[ip] = vs::Vector{4.0 + 0.5 * ip, 6.0 + 0.25 * ip, 5.0};
+            grid.force[ip] = vs::Vector{1.0, -0.5 * ip, 0.25};
+            grid.epsilon[ip] = vs::Vector{1.0, 0.5, 0.75};
+            grid.orientation[ip] = tmat;
+        }
+    }
+
+    {
+        amrex::ParmParse pp("Actuator.BruteForce");
+        pp.add("spreading_cutoff", false);
+    }
+    {
+        amrex::ParmParse pp("Actuator.Cutoff");
+        pp.add("spreading_cutoff", true);
+    }
+    {
+        amrex::ParmParse pp("Actuator.BruteForceTol");
+        pp.add("spreading_cutoff", false);
+        pp.add("spreading_tolerance", 1.0e-3);
+    }
+    {
+        amrex::ParmParse pp("Actuator.CutoffTol");
+        pp.add("spreading_cutoff", true);
+        pp.add("spreading_tolerance", 1.0e-3);
+    }
+
+    auto compute_src = [&](const std::string& prefix) {
+        amr_wind::actuator::ops::ActSrcOp<
+            FlatPlate, amr_wind::actuator::ActSrcLine>
+            src_op(data);
+        amr_wind::actuator::utils::ActParser pp(prefix, "Actuator.F1");
+        src_op.read_inputs(pp);
+        src_op.initialize();
+        src_op.setup_op();
+
+        src.setVal(0.0);
+        const int nlevels = sim().repo().num_active_levels();
+        for (int lev = 0; lev < nlevels; ++lev) {
+            const auto& geom = sim().mesh().Geom(lev);
+            for (amrex::MFIter mfi(src(lev)); mfi.isValid(); ++mfi) {
+                src_op(lev, mfi, geom);
+            }
+        }
+    };
+
+    auto max_diff = [&]() {
+        amrex::Real diff = 0.0;
+        const int nlevels = sim().repo().num_active_levels();
+        for (int lev = 0; lev < nlevels; ++lev) {
+            amrex::MultiFab::Subtract(src_gold(lev), src(lev), 0, 0, 3, 0);
+            for (int comp = 0; comp < AMREX_SPACEDIM; ++comp) {
+                diff = amrex::max(diff, src_gold(lev).norm0(comp, 0));
+            }
+        }
+        return diff;
+    };
+
+    const std::vector<std::pair<std::string, std::string>> cases{
+        {"Actuator.BruteForce", "Actuator.Cutoff"},
+        {"Actuator.BruteForceTol", "Actuator.CutoffTol"}};
+    for (const auto& cc : cases) {
+        compute_src(cc.first);
+        for (int lev = 0; lev < sim().repo().num_active_levels(); ++lev) {
+            amrex::MultiFab::Copy(src_gold(lev), src(lev), 0, 0, 3, 0);
+        }
+        EXPECT_GT(src(0).norm0(0), 0.0);
+
+        compute_src(cc.second);
+        EXPECT_NEAR(max_diff(), 0.0, 1.0e-12);
+    }
+}
 } // namespace amr_wind_tests
@@ -6,6 +6,7 @@
 #include "amr-wind/core/vs/vector_space.H"
 
 #include <algorithm>
+#include <set>
 
 namespace amr_wind_tests {
 namespace {
@@ -48,6 +49,60 @@ protected:
     }
 };
 
+/** Sample velocities at the points of two actuators shared by all ranks
+ */
+amrex::Vector<amr_wind::vs::Vector> sample_shared_actuators(
+    amrex::AmrCore& mesh,
+    const amr_wind::Field& vel,
+    const amr_wind::Field& density,
+    const bool use_sub_comms)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const int num_turbines = 2;
+    const int num_nodes = 16;
+
+    TestActContainer ac(mesh, num_turbines);
+    auto& data = ac.get_data_obj();
+    for (int it = 0; it < num_turbines; ++it) {
+        data.num_pts[it] = num_nodes;
+        data.global_id[it] = it;
+    }
+
+    if (use_sub_comms) {
+        amrex::Vector<amrex::RealBox> bound_boxes;
+        amrex::Vector<std::set<int>> procs(num_turbines);
+        for (int it = 0; it < num_turbines; ++it) {
+            const amrex::Real xpos = 32.0 * (it + 1);
+            bound_boxes.emplace_back(
+                amrex::RealArray{xpos - 1.0, 31.0, 0.0},
+                amrex::RealArray{xpos + 1.0, 33.0, 8.0});
+            for (int ip = 0; ip < nprocs; ++ip) {
+                procs[it].insert(ip);
+            }
+        }
+        ac.use_sub_communicators(bound_boxes, procs);
+    }
+
+    ac.initialize_container();
+
+    const amrex::Real dz = mesh.Geom(0).CellSize(2);
+    const amrex::Real ypos = 32.0 * (iproc + 1);
+    for (int it = 0, idx = 0; it < num_turbines; ++it) {
+        const amrex::Real xpos = 32.0 * (it + 1);
+        for (int ni = 0; ni < num_nodes; ++ni, ++idx) {
+            data.position[idx] =
+                amr_wind::vs::Vector(xpos, ypos, (ni + 0.5) * dz);
+        }
+    }
+
+    ac.update_positions();
+    ac.sample_fields(vel, density);
+    ac.Redistribute();
+
+    return data.velocity;
+}
+
 } // namespace
 
 TEST_F(ActuatorTest, act_container)
@@ -168,4 +223,31 @@ TEST_F(ActuatorTest, act_container)
     }
 }
 
+TEST_F(ActuatorTest, act_container_sub_comms)
+{
+    if (amrex::ParallelDescriptor::NProcs() > 2) {
+        GTEST_SKIP();
+    }
+
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 3);
+    auto& density = sim().repo().declare_field("density", 1, 3);
+    init_field(vel);
+    density.setVal(1.0);
+
+    const auto vel_global =
+        sample_shared_actuators(mesh(), vel, density, false);
+    const auto vel_group = sample_shared_actuators(mesh(), vel, density, true);
+
+    // Reducing only within the communication group must not change the
+    // sampled velocities
+    ASSERT_EQ(vel_global.size(), vel_group.size());
+    constexpr amrex::Real tol = 1.0e-12;
+    for (int ip = 0; ip < static_cast<int>(vel_global.size()); ++ip) {
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            EXPECT_NEAR(vel_group[ip][n], vel_global[ip][n], tol);
+        }
+    }
+}
+
 } // namespace amr_wind_tests
@@ -2,6 +2,7 @@
 
 #include "amr-wind/wind_energy/actuator/aero/AirfoilTable.H"
 #include "amr-wind/utilities/trig_ops.H"
+#include "amr-wind/utilities/linear_interpolation.H"
 
 #include <string>
 
@@ -92,4 +93,39 @@ TEST(Airfoil, airfoil_lookup)
     }
 }
 
+TEST(Airfoil, airfoil_fast_lookup)
+{
+    using AirfoilLoader = ::amr_wind::actuator::AirfoilLoader;
+    auto ss_txt = generate_txt_airfoil();
+    auto ss_of = generate_openfast_airfoil();
+    auto af_txt = AirfoilLoader::load_text_file(ss_txt);
+    auto af_of = AirfoilLoader::load_openfast_airfoil(ss_of);
+
+    for (const auto* af : {af_txt.get(), af_of.get()}) {
+        EXPECT_GT(af->num_bins(), 0);
+        const auto& aoa = af->aoa();
+        const amrex::Real aoa_min = aoa.front() - 0.1;
+        const amrex::Real aoa_max = aoa.back() + 0.1;
+
+        // Sample the table entries exactly as well as points in between and
+        // outside the table
+        amrex::Vector<amrex::Real> aoa_test(aoa.begin(), aoa.end());
+        const int nsamples = 1001;
+        for (int i = 0; i < nsamples; ++i) {
+            aoa_test.push_back(
+                aoa_min + (aoa_max - aoa_min) * i / (nsamples - 1));
+        }
+
+        amrex::Real cl, cd, cm;
+        for (const auto& aoa_in : aoa_test) {
+            const auto gold =
+                ::amr_wind::interp::linear(aoa, af->polars(), aoa_in);
+            (*af)(aoa_in, cl, cd, cm);
+            EXPECT_NEAR(cl, gold.x(), 1.0e-12);
+            EXPECT_NEAR(cd, gold.y(), 1.0e-12);
+            EXPECT_NEAR(cm, gold.z(), 1.0e-12);
+        }
+    }
+}
+
 } // namespace amr_wind_tests
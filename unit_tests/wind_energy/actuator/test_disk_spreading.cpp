@@ -0,0 +1,171 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/wind_energy/actuator/disk/disk_spreading.H"
+
+namespace amr_wind_tests {
+namespace {
+namespace act = amr_wind::actuator;
+namespace vs = amr_wind::vs;
+
+//! Minimal stand-in for the disk source term operator used by the spreading
+struct DiskSrc
+{
+    using TraitType = act::UniformCt;
+
+    struct DataType
+    {
+        act::UniformCtData m_meta;
+        act::ActGrid m_grid;
+
+        const act::UniformCtData& meta() const { return m_meta; }
+        const act::ActGrid& grid() const { return m_grid; }
+    };
+
+    explicit DiskSrc(amr_wind::Field& src) : m_act_src(src) {}
+
+    void copy_to_device()
+    {
+        const auto& grid = m_data.grid();
+        m_pos.resize(grid.pos.size());
+        m_force.resize(grid.force.size());
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, grid.pos.begin(), grid.pos.end(),
+            m_pos.begin());
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, grid.force.begin(), grid.force.end(),
+            m_force.begin());
+    }
+
+    DataType m_data;
+    amr_wind::Field& m_act_src;
+    act::DeviceVecList m_pos;
+    act::DeviceVecList m_force;
+};
+
+using SpreadType = act::ops::SpreadingFunction<DiskSrc>;
+
+class DiskSpreadingTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{32, 32, 32}};
+            pp.add("max_grid_size", 8);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{-16.0, -16.0, -16.0}};
+            amrex::Vector<amrex::Real> probhi{{16.0, 16.0, 16.0}};
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+
+    //! Disk at the origin with its normal along x
+    static void setup_disk(DiskSrc& disk, const int npts)
+    {
+        auto& meta = disk.m_data.m_meta;
+        auto& grid = disk.m_data.m_grid;
+        meta.num_force_pts = npts;
+        meta.num_force_theta_pts = 8;
+        meta.center = vs::Vector(0.0, 0.0, 0.0);
+        meta.normal_vec = vs::Vector(1.0, 0.0, 0.0);
+        meta.diameter = 10.0;
+        meta.dr = meta.radius() / amrex::max(npts, 1);
+        meta.epsilon = 1.0;
+
+        grid.pos.resize(npts);
+        grid.force.resize(npts);
+        for (int ip = 0; ip < npts; ++ip) {
+            const amrex::Real rr = (ip + 0.5) * meta.dr;
+            grid.pos[ip] = vs::Vector(0.0, rr, 0.0);
+            grid.force[ip] = vs::Vector(-1.0, 0.1 * (ip + 1), 0.0);
+        }
+        disk.copy_to_device();
+    }
+
+    //! Spread the disk forces into the source term field
+    static void
+    spread(SpreadType& spreading, DiskSrc& disk, const amrex::Geometry& geom)
+    {
+        auto& src = disk.m_act_src(0);
+        src.setVal(0.0);
+        spreading.update_bounding_box(disk);
+        for (amrex::MFIter mfi(src); mfi.isValid(); ++mfi) {
+            spreading(disk, 0, mfi, geom);
+        }
+    }
+
+    void check_culling(const std::string& spreading_type)
+    {
+        initialize_mesh();
+        auto& src = sim().repo().declare_field("actuator_src_term", 3, 0);
+        const auto& geom = mesh().Geom(0);
+
+        DiskSrc disk(src);
+        setup_disk(disk, 3);
+        SpreadType spreading;
+        spreading.initialize(spreading_type);
+
+        // Some boxes must be away from the disk for the test to be meaningful
+        spreading.update_bounding_box(disk);
+        int nskipped = 0;
+        for (amrex::MFIter mfi(src(0)); mfi.isValid(); ++mfi) {
+            if (spreading.overlap_box(mfi.tilebox(), geom).isEmpty()) {
+                ++nskipped;
+            }
+        }
+        amrex::ParallelDescriptor::ReduceIntSum(nskipped);
+        EXPECT_GT(nskipped, 0);
+
+        spread(spreading, disk, geom);
+        amrex::MultiFab culled(
+            src(0).boxArray(), src(0).DistributionMap(), 3, 0);
+        amrex::MultiFab::Copy(culled, src(0), 0, 0, 3, 0);
+
+        spreading.use_bounding_box() = false;
+        spread(spreading, disk, geom);
+
+        // Disk forces have no z component
+        EXPECT_GT(src(0).norm0(0), 0.0);
+        EXPECT_GT(src(0).norm0(1), 0.0);
+        amrex::MultiFab::Subtract(culled, src(0), 0, 0, 3, 0);
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            EXPECT_NEAR(culled.norm0(n), 0.0, 1.0e-12);
+        }
+    }
+};
+
+} // namespace
+
+TEST_F(DiskSpreadingTest, uniform_gaussian_culling)
+{
+    check_culling("UniformGaussian");
+}
+
+TEST_F(DiskSpreadingTest, linear_basis_culling)
+{
+    check_culling("LinearBasis");
+}
+
+TEST_F(DiskSpreadingTest, no_points)
+{
+    initialize_mesh();
+    auto& src = sim().repo().declare_field("actuator_src_term", 3, 0);
+    const auto& geom = mesh().Geom(0);
+
+    DiskSrc disk(src);
+    setup_disk(disk, 0);
+    SpreadType spreading;
+    spreading.initialize("LinearBasis");
+    spreading.update_bounding_box(disk);
+    for (amrex::MFIter mfi(src(0)); mfi.isValid(); ++mfi) {
+        EXPECT_TRUE(spreading.overlap_box(mfi.tilebox(), geom).isEmpty());
+    }
+}
+
+} // namespace amr_wind_tests
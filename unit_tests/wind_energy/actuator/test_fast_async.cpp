@@ -0,0 +1,137 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/wind_energy/actuator/turbine/fast/FastIface.H"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+namespace amr_wind_tests {
+namespace {
+class FastAsyncTest : public MeshTest
+{};
+
+/** FAST backend that emulates the turbine time integration
+ *
+ *  Allows testing the scheduling of turbine steps without the OpenFAST
+ *  library. Each step blocks until the test releases the gate.
+ */
+class MockFastIface : public ::exw_fast::FastIface
+{
+public:
+    explicit MockFastIface(const amr_wind::CFDSim& sim)
+        : ::exw_fast::FastIface(sim), m_gate(m_release.get_future().share())
+    {}
+
+    ~MockFastIface() override
+    {
+        release();
+        wait_for_all();
+    }
+
+    void release()
+    {
+        if (!m_released) {
+            m_released = true;
+            m_release.set_value();
+        }
+    }
+
+    std::atomic<int> num_steps{0};
+    std::atomic<int> max_active{0};
+    std::atomic<bool> stepped_on_main{false};
+    std::thread::id main_thread{std::this_thread::get_id()};
+
+protected:
+    void fast_step_turbine(::exw_fast::FastTurbine& fi) override
+    {
+        const int active = ++m_active;
+        if (active > max_active) {
+            max_active = active;
+        }
+        if (std::this_thread::get_id() == main_thread) {
+            stepped_on_main = true;
+        } else {
+            m_gate.wait();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        fi.time_index += fi.num_substeps;
+        --m_active;
+        ++num_steps;
+    }
+
+    void write_velocity_data(const ::exw_fast::FastTurbine& /*unused*/) override
+    {}
+
+private:
+    std::promise<void> m_release;
+    std::shared_future<void> m_gate;
+    bool m_released{false};
+    std::atomic<int> m_active{0};
+};
+
+void init_mock_turbine(::exw_fast::FastTurbine& fi, const int gid)
+{
+    fi.tlabel = "T00" + std::to_string(gid);
+    fi.tid_local = -1;
+    fi.tid_global = gid;
+    fi.dt_cfd = 0.0625;
+    fi.dt_fast = 0.00625;
+    fi.num_substeps = 10;
+    fi.stop_time = 10.0;
+    fi.chkpt_interval = 100;
+    fi.is_solution0 = false;
+    fi.async_step = true;
+}
+
+} // namespace
+
+TEST_F(FastAsyncTest, fast_async_step)
+{
+    initialize_mesh();
+
+    ::exw_fast::FastTurbine fi1;
+    ::exw_fast::FastTurbine fi2;
+    init_mock_turbine(fi1, 1);
+    init_mock_turbine(fi2, 2);
+
+    MockFastIface fast(sim());
+    fast.register_turbine(fi1);
+    fast.register_turbine(fi2);
+    EXPECT_EQ(fast.num_local_turbines(), 2);
+
+    // Launching the steps must not block the calling thread
+    fast.advance_turbine_async(fi1.tid_local);
+    fast.advance_turbine_async(fi2.tid_local);
+    EXPECT_TRUE(fast.is_pending(fi1.tid_local));
+    EXPECT_TRUE(fast.is_pending(fi2.tid_local));
+    EXPECT_EQ(fast.num_steps, 0);
+
+    fast.release();
+    fast.wait_for_turbine(fi2.tid_local);
+    EXPECT_FALSE(fast.is_pending(fi2.tid_local));
+    fast.wait_for_turbine(fi1.tid_local);
+    EXPECT_FALSE(fast.is_pending(fi1.tid_local));
+
+    // Turbines are advanced one after another on the helper thread
+    EXPECT_EQ(fast.num_steps, 2);
+    EXPECT_EQ(fast.max_active, 1);
+    EXPECT_FALSE(fast.stepped_on_main);
+    EXPECT_EQ(fi1.time_index, 10);
+    EXPECT_EQ(fi2.time_index, 10);
+
+    // A subsequent launch waits for the previous step of the same turbine
+    fast.advance_turbine_async(fi1.tid_local);
+    fast.advance_turbine_async(fi1.tid_local);
+    fast.wait_for_turbine(fi1.tid_local);
+    EXPECT_EQ(fi1.time_index, 30);
+
+    // The synchronous path advances the turbine on the calling thread
+    fast.advance_turbine(fi2.tid_local);
+    EXPECT_TRUE(fast.stepped_on_main);
+    EXPECT_EQ(fi2.time_index, 20);
+    EXPECT_EQ(fast.num_steps, 5);
+}
+
+} // namespace amr_wind_tests
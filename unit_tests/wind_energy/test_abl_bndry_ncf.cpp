@@ -0,0 +1,155 @@
+#include "abl_test_utils.H"
+#include "aw_test_utils/iter_tools.H"
+#include "aw_test_utils/test_utils.H"
+#include "amr-wind/equation_systems/icns/icns.H"
+#include "amr-wind/wind_energy/ABLBoundaryPlane.H"
+
+namespace amr_wind_tests {
+namespace {
+
+//! Set a velocity field that varies in every direction with a non-trivial
+//! mantissa so that the lossy quantization changes the stored values
+void init_velocity(amr_wind::Field& velocity)
+{
+    run_algorithm(velocity, [&](const int lev, const amrex::MFIter& mfi) {
+        auto vel = velocity(lev).array(mfi);
+        const auto& bx = mfi.validbox();
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            vel(i, j, k, 0) = 8.0 + 0.123456789 * j + 0.0314159265 * k;
+            vel(i, j, k, 1) = 1.0 / (1.0 + i + j + 0.1 * k);
+            vel(i, j, k, 2) = 0.271828182 * (j - 4) * (k - 32) / (1.0 + i);
+        });
+    });
+}
+
+//! Maximum deviation of the velocity read back on the xlo boundary plane from
+//! the face values that were written out
+amrex::Real xlo_plane_error(
+    const amrex::Geometry& geom,
+    const amrex::MultiFab& velocity,
+    const amrex::MultiFab& bndry)
+{
+    // Ghost cells adjacent to the xlo face, excluding the edges and corners
+    const amrex::Box xlo_bx = amrex::adjCellLo(geom.Domain(), 0);
+    amrex::Real err = amrex::ReduceMax(
+        velocity, bndry, 1,
+        [=] AMREX_GPU_HOST_DEVICE(
+            amrex::Box const& bx, amrex::Array4<amrex::Real const> const& vel,
+            amrex::Array4<amrex::Real const> const& bdy) -> amrex::Real {
+            amrex::Real err_fab = 0.0;
+
+            const auto lbx = bx & xlo_bx;
+            amrex::Loop(lbx, [=, &err_fab](int i, int j, int k) noexcept {
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    const amrex::Real face =
+                        0.5 * (vel(i, j, k, n) + vel(i + 1, j, k, n));
+                    err_fab =
+                        amrex::max(err_fab, std::abs(bdy(i, j, k, n) - face));
+                }
+            });
+
+            return err_fab;
+        });
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    return err;
+}
+} // namespace
+
+class ABLBndryCompressionTest : public ABLMeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        ABLMeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<int> periodic{{0, 1, 1}};
+            pp.addarr("is_periodic", periodic);
+        }
+        {
+            amrex::ParmParse pp("xlo");
+            pp.add("type", (std::string) "mass_inflow");
+            pp.add("density", 1.0);
+            pp.addarr("velocity", amrex::Vector<amrex::Real>{6.0, 0.5, 0.0});
+        }
+        {
+            amrex::ParmParse pp("xhi");
+            pp.add("type", (std::string) "pressure_outflow");
+        }
+    }
+
+    /** Write the xlo plane at two times with the requested compression, read
+     *  it back and return the maximum error of the velocity on the plane
+     */
+    amrex::Real roundtrip_error(
+        const std::string& compression, const amrex::Real tol = 0.0)
+    {
+        const std::string fname = "abl_bndry_" + compression + ".nc";
+        populate_parameters();
+        {
+            amrex::ParmParse pp("ABL");
+            pp.add("bndry_io_mode", 0);
+            pp.add("bndry_file", fname);
+            pp.add("bndry_output_format", (std::string) "netcdf");
+            pp.addarr("bndry_planes", amrex::Vector<std::string>{"xlo"});
+            pp.addarr(
+                "bndry_var_names", amrex::Vector<std::string>{"velocity"});
+            pp.add("bndry_compression", compression);
+            pp.add("bndry_compression_tolerance", tol);
+        }
+        initialize_mesh();
+
+        auto& pde_mgr = sim().pde_manager();
+        auto& mom_eqn = pde_mgr.register_icns();
+        mom_eqn.initialize();
+
+        auto& velocity = sim().repo().get_field("velocity");
+        init_velocity(velocity);
+
+        {
+            amr_wind::ABLBoundaryPlane writer(sim());
+            writer.initialize_data();
+            writer.write_header();
+            time().set_restart_time(0, 0.0);
+            writer.write_file();
+            time().set_restart_time(1, 1.0);
+            writer.write_file();
+        }
+
+        // Reading back at the first time avoids any interpolation error
+        {
+            amrex::ParmParse pp("ABL");
+            pp.add("bndry_io_mode", 1);
+        }
+        time().set_restart_time(0, 0.0);
+        amr_wind::ABLBoundaryPlane reader(sim());
+        reader.initialize_data();
+        reader.read_header();
+        reader.read_file();
+
+        const int lev = 0;
+        amrex::MultiFab bndry(
+            velocity(lev).boxArray(), velocity(lev).DistributionMap(),
+            AMREX_SPACEDIM, 1);
+        bndry.setVal(0.0);
+        reader.populate_data(lev, 0.0, velocity, bndry);
+
+        return xlo_plane_error(mesh().Geom(lev), velocity(lev), bndry);
+    }
+};
+
+TEST_F(ABLBndryCompressionTest, lossless)
+{
+    EXPECT_EQ(roundtrip_error("lossless"), 0.0);
+}
+
+TEST_F(ABLBndryCompressionTest, lossy)
+{
+    const amrex::Real tol = 1.0e-3;
+    const amrex::Real err = roundtrip_error("lossy", tol);
+    EXPECT_LE(err, tol);
+    // The data must actually have been quantized
+    EXPECT_GT(err, 0.0);
+}
+
+} // namespace amr_wind_tests
@@ -29,6 +29,73 @@ void write_ncf()
     vvel.put(fill_v.data(), start, count);
     wvel.put(fill_w.data(), start, count);
 }
+
+//! Write cell-center coordinates of a (nx, ny, nz) grid spanning the ABL test
+//! domain as the velocity components
+void write_coords_ncf(
+    const std::string& fname, const int nx, const int ny, const int nz)
+{
+    ncutils::NCFile ncf = ncutils::NCFile::create(fname);
+    ncf.def_dim("nx", nx);
+    ncf.def_dim("ny", ny);
+    ncf.def_dim("nz", nz);
+    const std::vector<std::string> three_dim{"nx", "ny", "nz"};
+    auto uvel = ncf.def_var("uvel", NC_DOUBLE, three_dim);
+    auto vvel = ncf.def_var("vvel", NC_DOUBLE, three_dim);
+    auto wvel = ncf.def_var("wvel", NC_DOUBLE, three_dim);
+
+    const double dx = 120.0 / nx;
+    const double dy = 120.0 / ny;
+    const double dz = 1000.0 / nz;
+    std::vector<double> fill_u, fill_v, fill_w;
+    for (int i = 0; i < nx; ++i) {
+        for (int j = 0; j < ny; ++j) {
+            for (int k = 0; k < nz; ++k) {
+                fill_u.push_back((i + 0.5) * dx);
+                fill_v.push_back((j + 0.5) * dy);
+                fill_w.push_back((k + 0.5) * dz);
+            }
+        }
+    }
+    const std::vector<size_t> start{0, 0, 0};
+    const std::vector<size_t> count{
+        static_cast<size_t>(nx), static_cast<size_t>(ny),
+        static_cast<size_t>(nz)};
+    uvel.put(fill_u.data(), start, count);
+    vvel.put(fill_v.data(), start, count);
+    wvel.put(fill_w.data(), start, count);
+}
+
+//! Maximum deviation of the velocity from the cell-center coordinates,
+//! excluding the cells adjacent to the domain boundaries
+amrex::Real coords_error(const amrex::Geometry& geom, amrex::MultiFab& velocity)
+{
+    const auto& domain = geom.Domain();
+    const auto dx = geom.CellSizeArray();
+    const auto problo = geom.ProbLoArray();
+    const auto ibx = amrex::grow(domain, -1);
+    amrex::Real err = amrex::ReduceMax(
+        velocity, 0,
+        [=] AMREX_GPU_HOST_DEVICE(
+            amrex::Box const& bx,
+            amrex::Array4<amrex::Real const> const& vel) -> amrex::Real {
+            amrex::Real err_fab = 0.0;
+
+            amrex::Loop(bx & ibx, [=, &err_fab](int i, int j, int k) noexcept {
+                const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                err_fab = amrex::max(
+                    err_fab, std::abs(vel(i, j, k, 0) - x),
+                    std::abs(vel(i, j, k, 1) - y),
+                    std::abs(vel(i, j, k, 2) - z));
+            });
+
+            return err_fab;
+        });
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    return err;
+}
 } // namespace
 
 TEST_F(ABLMeshTest, abl_init_netcdf)
@@ -51,14 +118,9 @@ TEST_F(ABLMeshTest, abl_init_netcdf)
     auto velocity = velocityf.vec_ptrs();
 
     amr_wind::ABLFieldInitFile ablinitfile;
-    run_algorithm(
-        mesh().num_levels(), velocity,
-        [&](const int lev, const amrex::MFIter& mfi) {
-            auto vel = velocity[lev]->array(mfi);
-
-            const auto& bx = mfi.validbox();
-            ablinitfile(bx, mesh().Geom(lev), vel, lev);
-        });
+    for (int lev = 0; lev < mesh().num_levels(); ++lev) {
+        ablinitfile(mesh().Geom(lev), *velocity[lev], lev);
+    }
 
     const int nlevels = mesh().num_levels();
     const amrex::Real tol = 1.0e-12;
@@ -130,11 +192,8 @@ TEST_F(ABLMeshTest, abl_init_netcdf_multilevel)
     for (int lev = 0; lev < nlevels; ++lev) {
 
         // Fill base level using input file
-        for (amrex::MFIter mfi(velocityf(lev)); mfi.isValid(); ++mfi) {
-            auto vel = velocity[lev]->array(mfi);
-            const auto& bx = mfi.validbox();
-            interp_fine_levels = ablinitfile(bx, mesh().Geom(lev), vel, lev);
-        };
+        interp_fine_levels =
+            ablinitfile(mesh().Geom(lev), velocityf(lev), lev);
 
         // Fill the finer levels using coarse data
         if (interp_fine_levels) {
@@ -156,6 +215,56 @@ TEST_F(ABLMeshTest, abl_init_netcdf_multilevel)
     }
 }
 
+TEST_F(ABLMeshTest, abl_init_netcdf_index_order)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("initial_condition_input_file", (std::string) "abl_xyz.nc");
+    }
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 4);
+    }
+    write_coords_ncf("abl_xyz.nc", 8, 8, 64);
+
+    initialize_mesh();
+    auto& velocityf = mesh().field_repo().declare_field("velocity", 3, 0);
+
+    amr_wind::ABLFieldInitFile ablinitfile;
+    ablinitfile(mesh().Geom(0), velocityf(0), 0);
+
+    // Matching dimensions must reproduce the file exactly
+    EXPECT_NEAR(coords_error(mesh().Geom(0), velocityf(0)), 0.0, 1.0e-12);
+    remove("abl_xyz.nc");
+}
+
+TEST_F(ABLMeshTest, abl_init_netcdf_interp)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("initial_condition_input_file", (std::string) "abl_coarse.nc");
+    }
+    {
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 4);
+    }
+    // Half the resolution of the 8 x 8 x 64 mesh in each direction
+    write_coords_ncf("abl_coarse.nc", 4, 4, 32);
+
+    initialize_mesh();
+    auto& velocityf = mesh().field_repo().declare_field("velocity", 3, 0);
+
+    amr_wind::ABLFieldInitFile ablinitfile;
+    ablinitfile(mesh().Geom(0), velocityf(0), 0);
+
+    // Linear fields are recovered away from the boundaries, where the input
+    // is extrapolated with a constant value
+    EXPECT_NEAR(coords_error(mesh().Geom(0), velocityf(0)), 0.0, 1.0e-10);
+    remove("abl_coarse.nc");
+}
+
 // Clean up ABL NetCDF file if needed
 TEST_F(ABLMeshTest, abl_netcdf_cleanup)
 {
@@ -0,0 +1,85 @@
+#include "abl_test_utils.H"
+#include "amr-wind/wind_energy/ABLStats.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+
+namespace amr_wind_tests {
+
+TEST_F(ABLMeshTest, stats_collective_netcdf)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("stats_output_format", std::string("netcdf"));
+        pp.add("stats_output_frequency", 1);
+        pp.add("stats_parallel_netcdf", true);
+    }
+    initialize_mesh();
+
+    auto& icns = sim().pde_manager().register_icns();
+    icns.initialize();
+    sim().init_physics();
+    sim().create_turbulence_model();
+
+    const int lev = 0;
+    for (auto& pp : sim().physics()) {
+        pp->pre_init_actions();
+        pp->initialize_fields(lev, sim().mesh().Geom(lev));
+    }
+    icns.fields().mueff.setVal(1.0e-5);
+    sim().repo().get_field("temperature_mueff").setVal(1.0e-5);
+
+    // The file is closed when the statistics object goes out of scope
+    amr_wind::ABLWallFunction wall_func(sim());
+    amrex::Vector<amrex::Real> h_gold;
+    amrex::Vector<amrex::Real> u_gold;
+    amrex::Vector<amrex::Real> theta_gold;
+    {
+        amr_wind::ABLStats stats(sim(), wall_func, 2);
+        stats.post_init_actions();
+        stats.post_advance_work();
+
+        const auto& pa_vel = stats.vel_profile_coarse();
+        const auto& pa_temp = stats.theta_profile();
+        const int nlevels = pa_vel.ncell_line();
+        h_gold = pa_vel.line_centroids();
+        for (int k = 0; k < nlevels; ++k) {
+            u_gold.push_back(pa_vel.line_average_cell(k, 0));
+            theta_gold.push_back(pa_temp.line_average_cell(k, 0));
+        }
+    }
+
+    const std::string fname =
+        "post_processing/" +
+        amrex::Concatenate("abl_statistics", time().time_index()) + ".nc";
+    auto ncf = ncutils::NCFile::open_par(
+        fname, NC_NOWRITE | NC_MPIIO,
+        amrex::ParallelDescriptor::Communicator(), MPI_INFO_NULL);
+    ncf.par_access(NC_COLLECTIVE);
+    ASSERT_EQ(ncf.dim("num_time_steps").len(), 1u);
+
+    amrex::Real time_out = -1.0;
+    ncf.var("time").get(&time_out, {0}, {1});
+    EXPECT_NEAR(time_out, time().new_time(), 1.0e-12);
+
+    auto grp = ncf.group("mean_profiles");
+    const size_t nlevels = grp.dim("nlevels").len();
+    ASSERT_EQ(nlevels, h_gold.size());
+
+    std::vector<double> vals(nlevels);
+    grp.var("h").get(vals.data(), {0}, {nlevels});
+    for (size_t k = 0; k < nlevels; ++k) {
+        EXPECT_NEAR(vals[k], h_gold[k], 1.0e-12) << k;
+    }
+
+    grp.var("u").get(vals.data(), {0, 0}, {1, nlevels});
+    for (size_t k = 0; k < nlevels; ++k) {
+        EXPECT_NEAR(vals[k], u_gold[k], 1.0e-12) << k;
+    }
+
+    grp.var("theta").get(vals.data(), {0, 0}, {1, nlevels});
+    for (size_t k = 0; k < nlevels; ++k) {
+        EXPECT_NEAR(vals[k], theta_gold[k], 1.0e-12) << k;
+    }
+}
+
+} // namespace amr_wind_tests